@@ -0,0 +1,53 @@
+/**
+ * @file clock_bench.cpp
+ * @brief Microbenchmark: steady_clock::now() vs calibrated TscClock::now() vs BurstClock::now().
+ *
+ * Reports ns per call for each source; BurstClock is refreshed once per 32 calls
+ * (one burst), which is how workers use it.
+ *
+ * Usage: clock_bench [calls]   (default: 10'000'000)
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include "alpha/os/clock.hpp"
+
+namespace bench {
+using clock = std::chrono::steady_clock;
+
+template <class F>
+double ns_per_call(std::uint64_t calls, F&& f) {
+  std::int64_t sink = 0;
+  const auto t0 = clock::now();
+  for (std::uint64_t i = 0; i < calls; ++i) sink += f(i).time_since_epoch().count();
+  const auto t1 = clock::now();
+  if (sink == 42) std::cout << "";  // keep the loop
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) /
+         static_cast<double>(calls);
+}
+} // namespace bench
+
+int main(int argc, char** argv) {
+  const std::uint64_t calls = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10'000'000ULL;
+  const auto cal = alpha::os::TscClock::calibrate();
+  std::cout << "tsc: invariant=" << cal.invariant << " enabled=" << cal.enabled
+            << " hz=" << cal.hz << "\n";
+
+  alpha::os::BurstClock burst;
+  const double steady = bench::ns_per_call(calls, [](std::uint64_t) { return std::chrono::steady_clock::now(); });
+  const double tsc    = bench::ns_per_call(calls, [](std::uint64_t) { return alpha::os::TscClock::now(); });
+  const double coarse = bench::ns_per_call(calls, [&](std::uint64_t i) {
+    if ((i & 31) == 0) burst.refresh();
+    return burst.now();
+  });
+
+  std::cout << std::fixed << std::setprecision(2)
+            << "steady_clock::now   " << steady << " ns/call\n"
+            << "TscClock::now       " << tsc    << " ns/call\n"
+            << "BurstClock::now     " << coarse << " ns/call (refresh every 32)\n";
+  return 0;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file lookup_bench.cpp
+ * @brief Microbenchmark: scalar vs burst (group-prefetch) lookups as tables outgrow the LLC.
+ *
+ * For each table size the FlowTable is filled to ~50% and probed with random
+ * hitting keys, once via find() per key and once via find_burst() in bursts of 32.
+ * The ServiceIndex is bounded by Limits::MaxServices (it always fits in cache), so
+ * it is measured at its maximum size only. The VipTable is measured with one
+ * binding per VIP at 1M bindings (16 MiB of slots).
+ *
+ * Usage: lookup_bench [max_log2_slots]   (default 25 → 512 MiB of slots)
+ *
+ * Reports: Mlookups/s for both modes and the burst speed-up.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "alpha/routing/flow_table.hpp"
+#include "alpha/routing/service_index.hpp"
+#include "alpha/routing/vip_table.hpp"
+
+namespace bench {
+using clock = std::chrono::steady_clock;
+
+constexpr std::size_t kBurst   = 32;
+constexpr std::size_t kLookups = 1u << 22;
+
+inline double seconds_since(clock::time_point t0) {
+  return std::chrono::duration<double>(clock::now() - t0).count();
+}
+
+// Keeps results observable so the compiler cannot drop the lookups.
+inline void sink(std::uintptr_t v) {
+  static volatile std::uintptr_t s;
+  s = s + v;
+}
+
+void run_flow(std::size_t log2_slots) {
+  const std::size_t slots = std::size_t{1} << log2_slots;
+  alpha::routing::FlowTable ft(slots);
+  std::mt19937_64 rng{log2_slots};
+  std::vector<std::uint64_t> keys(slots / 2);
+  for (auto& k : keys) {
+    do { k = rng(); } while (k == 0);
+    (void)ft.insert(k, static_cast<std::uint32_t>(k), static_cast<std::uint32_t>(k & 7));
+  }
+  std::vector<std::uint64_t> probe(kLookups);
+  for (auto& k : probe) k = keys[rng() % keys.size()];
+
+  auto t0 = clock::now();
+  std::uintptr_t acc = 0;
+  for (auto k : probe) acc += reinterpret_cast<std::uintptr_t>(ft.find(k));
+  const double scalar = seconds_since(t0);
+  sink(acc);
+
+  std::vector<const alpha::routing::FlowEntry*> out(kBurst);
+  t0 = clock::now();
+  acc = 0;
+  for (std::size_t i = 0; i < probe.size(); i += kBurst) {
+    ft.find_burst(std::span<const std::uint64_t>(probe.data() + i, kBurst), out);
+    for (auto* e : out) acc += reinterpret_cast<std::uintptr_t>(e);
+  }
+  const double burst = seconds_since(t0);
+  sink(acc);
+
+  const double mib = static_cast<double>(slots * sizeof(alpha::routing::FlowEntry)) / (1024.0 * 1024.0);
+  const double n = static_cast<double>(kLookups);
+  std::cout << std::fixed << std::setprecision(2)
+            << "flow   slots=2^" << std::setw(2) << log2_slots
+            << "  table=" << std::setw(9) << mib << " MiB"
+            << "  scalar=" << std::setw(8) << n / scalar / 1e6 << " M/s"
+            << "  burst="  << std::setw(8) << n / burst / 1e6 << " M/s"
+            << "  speedup=" << std::setw(5) << scalar / burst << "x\n";
+}
+
+void run_service_index() {
+  alpha::routing::ServiceRegistry reg;
+  std::vector<std::string> ids;
+  const alpha::routing::PopList pops{alpha::routing::Pop{.id = "p0", .region = "r0", .ip = "192.0.2.1"}};
+  for (std::size_t i = 0; i < alpha::routing::Limits::MaxServices; ++i) {
+    ids.push_back("svc_" + std::to_string(i));
+    (void)reg.upsertService(ids.back(), std::span<const alpha::routing::Pop>(pops));
+  }
+  const auto idx = alpha::routing::ServiceIndex::compile(reg);
+
+  std::mt19937 rng{1};
+  std::vector<std::string_view> probe(kLookups);
+  for (auto& v : probe) v = ids[rng() % ids.size()];
+
+  auto t0 = clock::now();
+  std::uintptr_t acc = 0;
+  for (auto v : probe) acc += idx->find(v);
+  const double scalar = seconds_since(t0);
+  sink(acc);
+
+  std::vector<alpha::routing::ServiceHandle> out(kBurst);
+  t0 = clock::now();
+  acc = 0;
+  for (std::size_t i = 0; i < probe.size(); i += kBurst) {
+    idx->find_burst(std::span<const std::string_view>(probe.data() + i, kBurst), out);
+    for (auto h : out) acc += h;
+  }
+  const double burst = seconds_since(t0);
+  sink(acc);
+
+  const double n = static_cast<double>(kLookups);
+  std::cout << std::fixed << std::setprecision(2)
+            << "svcidx services=" << idx->size()
+            << "  scalar=" << n / scalar / 1e6 << " M/s"
+            << "  burst="  << n / burst / 1e6 << " M/s"
+            << "  speedup=" << scalar / burst << "x\n";
+}
+
+void run_vip_table(std::size_t bindings) {
+  alpha::routing::ServiceRegistry reg;
+  const alpha::routing::PopList pops{alpha::routing::Pop{.id = "p0", .region = "r0", .ip = "192.0.2.1"}};
+  (void)reg.upsertService("svc_a", std::span<const alpha::routing::Pop>(pops));
+  (void)reg.upsertService("svc_b", std::span<const alpha::routing::Pop>(pops));
+  std::vector<alpha::routing::VipBinding> binds(bindings);
+  for (std::size_t i = 0; i < bindings; ++i) {
+    binds[i] = {static_cast<std::uint32_t>(0x0A000000u + i), 443, 6, (i & 1) ? "svc_a" : "svc_b"};
+  }
+  const auto t = alpha::routing::VipTable::compile(binds, alpha::routing::ServiceIndex::compile(reg));
+  if (!t) { std::cout << "vip    compile failed\n"; return; }
+
+  std::mt19937 rng{2};
+  std::vector<alpha::routing::VipKey> probe(kLookups);
+  for (auto& k : probe) k = {static_cast<std::uint32_t>(0x0A000000u + rng() % bindings), 443, 6};
+
+  auto t0 = clock::now();
+  std::uintptr_t acc = 0;
+  for (const auto& k : probe) acc += (*t)->find(k);
+  const double scalar = seconds_since(t0);
+  sink(acc);
+
+  std::vector<alpha::routing::ServiceHandle> out(kBurst);
+  t0 = clock::now();
+  acc = 0;
+  for (std::size_t i = 0; i < probe.size(); i += kBurst) {
+    (*t)->find_burst(std::span<const alpha::routing::VipKey>(probe.data() + i, kBurst), out);
+    for (auto h : out) acc += h;
+  }
+  const double burst = seconds_since(t0);
+  sink(acc);
+
+  const double n = static_cast<double>(kLookups);
+  std::cout << std::fixed << std::setprecision(2)
+            << "vip    bindings=" << (*t)->size()
+            << "  scalar=" << n / scalar / 1e6 << " M/s"
+            << "  burst="  << n / burst / 1e6 << " M/s"
+            << "  speedup=" << scalar / burst << "x\n";
+}
+
+} // namespace bench
+
+int main(int argc, char** argv) {
+  const std::size_t max_log2 = (argc > 1) ? static_cast<std::size_t>(std::strtoul(argv[1], nullptr, 10)) : 25;
+
+  std::cout << "Lookup microbenchmark: scalar find() vs group-prefetch find_burst()\n";
+  std::cout << "----------------------------------------------------------------------\n";
+  for (std::size_t l = 12; l <= max_log2; l += 1) bench::run_flow(l);
+  bench::run_service_index();
+  bench::run_vip_table(std::size_t{1} << 20);
+  std::cout << std::flush;
+  return 0;
+}
@@ -0,0 +1,128 @@
+/**
+ * @file metrics_bench.cpp
+ * @brief Microbenchmark: seqlock MetricsSlot vs left-right LrMetricsSlot under a hot writer.
+ *
+ * One writer republishes a slot in a tight loop (optionally pausing between
+ * updates) while R reader threads load it. Reports, per variant and update rate:
+ * reads/s, writer updates/s, and the fraction of seqlock reads that gave up
+ * (dp::load_metrics() == false, i.e. the policy would treat the path as unusable).
+ * Left-right reads never fail by construction.
+ *
+ * Usage: metrics_bench [readers] [millis_per_run]   (defaults: 2, 300)
+ */
+
+#include <atomic>
+#include <barrier>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "alpha/routing/path_selection.hpp"
+
+namespace bench {
+using clock = std::chrono::steady_clock;
+using alpha::routing::LrMetricsSlot;
+using alpha::routing::MetricsSlot;
+using alpha::routing::PathMetrics;
+
+struct Result {
+  double reads_per_s   = 0.0;
+  double updates_per_s = 0.0;
+  double fail_ratio    = 0.0;
+};
+
+// Spin for roughly `n` pause iterations between writer updates (0 = flat out).
+inline void pause_n(std::uint32_t n) noexcept {
+  for (std::uint32_t i = 0; i < n; ++i) {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+  }
+}
+
+template <class Slot>
+Result run(std::size_t readers, std::chrono::milliseconds dur, std::uint32_t writer_gap) {
+  Slot slot{};
+  std::atomic<bool> stop{false};
+  std::barrier sync(static_cast<std::ptrdiff_t>(readers + 1));
+  std::atomic<std::uint64_t> reads{0}, fails{0}, updates{0};
+
+  std::thread writer([&] {
+    sync.arrive_and_wait();
+    PathMetrics m{};
+    std::uint64_t n = 0;
+    while (!stop.load(std::memory_order_relaxed)) {
+      m.rtt_us = static_cast<std::uint32_t>(n);
+      m.healthy = true;
+      alpha::routing::cp::update_metrics(slot, m);
+      ++n;
+      pause_n(writer_gap);
+    }
+    updates.store(n);
+  });
+
+  std::vector<std::thread> rs;
+  for (std::size_t r = 0; r < readers; ++r) {
+    rs.emplace_back([&] {
+      sync.arrive_and_wait();
+      PathMetrics out{};
+      std::uint64_t n = 0, f = 0;
+      while (!stop.load(std::memory_order_relaxed)) {
+        if constexpr (std::is_same_v<Slot, MetricsSlot>) {
+          f += alpha::routing::dp::load_metrics(slot, out) ? 0u : 1u;
+        } else {
+          alpha::routing::dp::load_metrics(slot, out);
+        }
+        ++n;
+      }
+      reads.fetch_add(n);
+      fails.fetch_add(f);
+    });
+  }
+
+  std::this_thread::sleep_for(dur);
+  stop.store(true);
+  writer.join();
+  for (auto& t : rs) t.join();
+
+  const double secs = std::chrono::duration<double>(dur).count();
+  Result res;
+  res.reads_per_s   = static_cast<double>(reads.load()) / secs;
+  res.updates_per_s = static_cast<double>(updates.load()) / secs;
+  res.fail_ratio    = reads.load() ? static_cast<double>(fails.load()) / static_cast<double>(reads.load()) : 0.0;
+  return res;
+}
+
+inline void print(const std::string& name, std::uint32_t gap, const Result& r) {
+  std::cout << std::fixed << std::setprecision(2)
+            << std::left << std::setw(10) << name
+            << "  writer_gap=" << std::setw(5) << gap
+            << "  reads/s="   << std::setw(14) << r.reads_per_s
+            << "  updates/s=" << std::setw(14) << r.updates_per_s
+            << std::setprecision(6)
+            << "  failed="    << r.fail_ratio
+            << '\n';
+}
+
+} // namespace bench
+
+int main(int argc, char** argv) {
+  const std::size_t readers = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 2;
+  const auto dur = std::chrono::milliseconds((argc > 2) ? std::strtoul(argv[2], nullptr, 10) : 300);
+
+  std::cout << "Metrics slot microbenchmark: 1 writer / " << readers << " readers\n";
+  std::cout << "----------------------------------------------------------------------\n";
+  for (std::uint32_t gap : {0u, 16u, 256u}) {
+    bench::print("seqlock", gap, bench::run<bench::MetricsSlot>(readers, dur, gap));
+    bench::print("leftright", gap, bench::run<bench::LrMetricsSlot>(readers, dur, gap));
+  }
+  std::cout << std::flush;
+  return 0;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file overlay_bench.cpp
+ * @brief Microbenchmark: full overlay relay recomputation (one- and two-relay, all pairs).
+ *
+ * PoPs are placed on a plane; leg RTT follows distance with random detours (so relays
+ * often win), ~10% of legs are down and some carry loss. Reports the recompute time per
+ * tick against the 500 ms probe interval, and how many (ingress, destination) pairs are
+ * better served through a relay. Then loads class 0 into ShortestPaths and compares a
+ * full rebuild with incremental apply() for small batches of edge changes (churn).
+ *
+ * Usage: overlay_bench [pops] [classes] [ticks]   (defaults: 500, 2, 3)
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "alpha/routing/overlay.hpp"
+#include "alpha/routing/shortest_path.hpp"
+
+namespace bench {
+using clock = std::chrono::steady_clock;
+using alpha::routing::OverlayClass;
+using alpha::routing::OverlayMatrix;
+using alpha::routing::OverlayRouter;
+using alpha::routing::PopIndex;
+using alpha::routing::ShortestPaths;
+
+OverlayMatrix make_matrix(std::size_t n, std::mt19937& rng) {
+  std::uniform_real_distribution<double> pos(0.0, 10'000.0), detour(1.0, 1.6);
+  std::vector<double> x(n), y(n);
+  for (std::size_t i = 0; i < n; ++i) { x[i] = pos(rng); y[i] = pos(rng); }
+  OverlayMatrix m(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    for (std::size_t j = 0; j < n; ++j) {
+      if (i == j || rng() % 10 == 0) continue;
+      const double km = std::hypot(x[i] - x[j], y[i] - y[j]);
+      const auto rtt  = static_cast<std::uint32_t>(km * 10.0 * detour(rng)) + 200;   // ~10 us/km RTT
+      const auto loss = static_cast<std::uint32_t>(rng() % 8 == 0 ? rng() % 30'000 : 0);
+      m.set(static_cast<PopIndex>(i), static_cast<PopIndex>(j), rtt, loss);
+    }
+  }
+  return m;
+}
+} // namespace bench
+
+int main(int argc, char** argv) {
+  const std::size_t n_pops    = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 500;
+  const std::size_t n_classes = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 2;
+  const int ticks             = argc > 3 ? std::atoi(argv[3]) : 3;
+  std::mt19937 rng{42};
+  const auto m = bench::make_matrix(n_pops, rng);
+
+  std::vector<bench::OverlayClass> classes(n_classes);
+  for (std::size_t c = 0; c < n_classes; ++c)
+    classes[c] = {static_cast<std::uint32_t>(c * 1'000'000), static_cast<std::uint32_t>(100 + c * 200)};
+  bench::OverlayRouter router(classes);
+
+  double best_ms = 1e30;
+  for (int t = 0; t < ticks; ++t) {
+    const auto t0 = bench::clock::now();
+    router.recompute(m);
+    const auto t1 = bench::clock::now();
+    best_ms = std::min(best_ms, std::chrono::duration<double, std::milli>(t1 - t0).count());
+  }
+
+  const auto table = router.current();
+  std::size_t relayed = 0, pairs = 0;
+  for (std::size_t i = 0; i < n_pops; ++i) {
+    for (std::size_t j = 0; j < n_pops; ++j) {
+      if (i == j) continue;
+      ++pairs;
+      relayed += table->best(static_cast<bench::PopIndex>(i), static_cast<bench::PopIndex>(j), 0).relays != 0 ? 1u : 0u;
+    }
+  }
+
+  std::cout << "pops=" << n_pops << " classes=" << n_classes << std::fixed << std::setprecision(1)
+            << "\nrecompute " << best_ms << " ms/tick (" << best_ms / static_cast<double>(n_classes) << " ms/class)"
+            << "\nrelayed   " << 100.0 * static_cast<double>(relayed) / static_cast<double>(pairs)
+            << "% of pairs (class 0)\n";
+
+  // Incremental shortest paths: full rebuild vs churn-sized batches.
+  bench::ShortestPaths sp(n_pops);
+  sp.load(m, classes[0]);
+  const auto r0 = bench::clock::now();
+  (void)sp.apply();  // the initial load exceeds the batch threshold: full rebuild
+  const auto r1 = bench::clock::now();
+  std::cout << "spt rebuild " << std::chrono::duration<double, std::milli>(r1 - r0).count() << " ms\n";
+  for (const std::size_t batch : {1u, 10u, 100u}) {
+    double ms = 0; std::size_t revisited = 0;
+    constexpr int kRounds = 20;
+    for (int r = 0; r < kRounds; ++r) {
+      for (std::size_t c = 0; c < batch; ++c) {
+        const auto u = static_cast<bench::PopIndex>(rng() % n_pops), v = static_cast<bench::PopIndex>(rng() % n_pops);
+        const std::uint32_t w = sp.weight(u, v);
+        if (w == bench::ShortestPaths::kNoEdge) continue;
+        sp.set_edge(u, v, rng() % 2 ? w + w / 2 : w / 2 + 1);   // degrade or improve a leg
+      }
+      const auto a0 = bench::clock::now();
+      revisited += sp.apply().recomputed;
+      ms += std::chrono::duration<double, std::milli>(bench::clock::now() - a0).count();
+    }
+    std::cout << "spt apply   batch=" << batch << " " << ms / kRounds << " ms ("
+              << revisited / kRounds << " entries revisited)\n";
+  }
+  return 0;
+}
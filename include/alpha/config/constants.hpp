@@ -57,12 +57,49 @@ inline constexpr bool     FAILOVER_RETURN_TO_PRIMARY      = true;   ///< Prefer
 inline constexpr double   FAILOVER_IMPROVE_PCT_TO_SWITCH  = 0.10;   ///< Require +10% score improvement to switch
 inline constexpr uint32_t FAILOVER_MIN_HOLD_MS            = 3000;   ///< Dwell to prevent flapping
 inline constexpr uint32_t FAILOVER_RECOVERY_HOLD_MS       = 5000;   ///< Time primary must remain healthy before R2P
+inline constexpr bool     FAILOVER_PREFER_SRLG_DISJOINT   = true;   ///< On current Down, prefer backups sharing no risk group
+inline constexpr uint32_t FAILOVER_RETURN_STEP_PPM        = 0;      ///< R2P ramp step (0 = move all traffic at once)
+inline constexpr uint32_t FAILOVER_MAX_SWITCHES_PER_TICK  = 256;    ///< Storm control: switches applied per tick
+inline constexpr uint32_t FAILOVER_MAX_SWITCHES_PER_TARGET = 0;     ///< Storm control: per backup path per tick (0 = no cap)
+inline constexpr bool     FAILOVER_PREEMPT_ON_FORECAST    = true;   ///< Leave a path whose forecast breaches its SLO
+
+// =====================
+// Metric Forecast Defaults
+// =====================
+inline constexpr float    FORECAST_ALPHA    = 0.5f;  ///< Level smoothing (inputs are already EWMA'd)
+inline constexpr float    FORECAST_BETA     = 0.2f;  ///< Trend smoothing
+inline constexpr float    FORECAST_DAMPING  = 0.9f;  ///< Trend damping per tick (bounds extrapolation)
+inline constexpr uint32_t FORECAST_TICK_MS  = 500;   ///< Metrics aggregation interval
+
+// =====================
+// Change-Point Detection Defaults
+// =====================
+inline constexpr float    CHANGE_DRIFT            = 0.05f;   ///< Relative deviation absorbed per sample (5%)
+inline constexpr float    CHANGE_THRESHOLD        = 1.0f;    ///< Accumulated relative deviation that raises an event
+inline constexpr float    CHANGE_BASELINE_ALPHA   = 0.02f;   ///< CUSUM reference tracking while in control
+inline constexpr uint32_t CHANGE_WARMUP_SAMPLES   = 8;       ///< Samples seeding the reference level
+inline constexpr float    CHANGE_RTT_FLOOR_US     = 1000.0f; ///< RTT scale floor (relative to at least 1 ms)
+inline constexpr float    CHANGE_LOSS_FLOOR       = 0.005f;  ///< Loss scale floor (relative to at least 0.5%)
+
+// =====================
+// Traffic Shift Defaults
+// =====================
+inline constexpr uint32_t SHIFT_STEP_PPM      = 100000;  ///< Share moved per ramp step (10%)
+inline constexpr uint32_t SHIFT_STEP_HOLD_MS  = 2000;    ///< Target must stay healthy this long at each step
 
 // =====================
 // Ingress Selector Defaults
 // =====================
 inline constexpr uint64_t INGRESS_HASH_SEED_DEFAULT = 0xA17A5EEDULL; ///< Deterministic hash salt
 
+// =====================
+// RSS Worker Sharding Defaults
+// =====================
+inline constexpr uint32_t RSS_INDIRECTION_BUCKETS     = 512;  ///< Hash buckets in the indirection table (power-of-two)
+inline constexpr double   RSS_REBALANCE_TARGET_RATIO  = 1.10; ///< Stop rebalancing once max/mean worker load <= this
+inline constexpr uint32_t RSS_MAX_MOVES_PER_ROUND     = 8;    ///< Bucket moves started per rebalance round
+inline constexpr uint32_t RSS_HANDOFF_FLOWS_PER_MOVE  = 4096; ///< Preallocated flow handoff capacity per migration
+
 // =====================
 // Anycast+BGP Simulator Defaults (attributes used if not provided)
 // =====================
@@ -0,0 +1,36 @@
+#pragma once
+/**
+ * @file policy_tables.hpp
+ * @brief Compile-time QoS profiles and the read-only tables derived from them.
+ * @details The default profile is assembled from constants.hpp; its tables are a
+ *          `constexpr` object, so embedded builds get them in read-only data with no
+ *          init-time cost. Runtime overrides still go through QoSPolicy::update_config().
+ */
+
+#include "alpha/config/constants.hpp"
+#include "alpha/routing/qos_policy.hpp"
+
+namespace alpha::config {
+
+/// Default QoS profile (thresholds, weights, DSCP) from named constants.
+inline constexpr alpha::routing::QoSProfile kDefaultQoSProfile{
+    .thresholds = {{
+        {constants::QOS_BULK_MAX_LAT_US, constants::QOS_BULK_MAX_JITTER_US, constants::QOS_BULK_MAX_LOSS},
+        {constants::QOS_BE_MAX_LAT_US,   constants::QOS_BE_MAX_JITTER_US,   constants::QOS_BE_MAX_LOSS},
+        {constants::QOS_INT_MAX_LAT_US,  constants::QOS_INT_MAX_JITTER_US,  constants::QOS_INT_MAX_LOSS},
+        {constants::QOS_RT_MAX_LAT_US,   constants::QOS_RT_MAX_JITTER_US,   constants::QOS_RT_MAX_LOSS},
+    }},
+    .weights = {.latency = constants::QOS_WEIGHT_LATENCY,
+                .jitter  = constants::QOS_WEIGHT_JITTER,
+                .loss    = constants::QOS_WEIGHT_LOSS},
+    .dscp = {{constants::DSCP_CS1, constants::DSCP_BE, constants::DSCP_AF31, constants::DSCP_EF}},
+};
+
+/// Tables for kDefaultQoSProfile, built by the compiler.
+inline constexpr alpha::routing::QoSTables kDefaultQoSTables =
+    alpha::routing::build_qos_tables(kDefaultQoSProfile);
+
+static_assert(kDefaultQoSTables.class_by_dscp[constants::DSCP_EF] == alpha::routing::QoSClass::Realtime);
+static_assert(kDefaultQoSTables.inv_latency_q32[3] == (std::uint64_t{1} << 32) / constants::QOS_RT_MAX_LAT_US);
+
+} // namespace alpha::config
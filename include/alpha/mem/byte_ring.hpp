@@ -0,0 +1,212 @@
+/**
+ * @file byte_ring.hpp
+ * @brief Single-producer/single-consumer ring of variable-length byte records.
+ *
+ * Design goals:
+ *  - Zero-copy on both sides: the producer writes into reserve()d ring memory,
+ *    the consumer reads the record in place via peek().
+ *  - Records are contiguous: a record that would straddle the end of the ring is
+ *    preceded by a padding record that fills the tail, and starts at offset 0.
+ *  - One-time allocation during setup via factory; no allocations after.
+ *  - Positions are monotonic 64-bit byte counters (no ABA, no "one slot open").
+ *
+ * Record layout (8-byte aligned): [RecordHeader | payload | pad to 8].
+ *
+ * Producer: reserve(len) → write → commit(used).   Consumer: peek() → read → release().
+ * Records up to max_record() bytes always fit once the ring drains.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <span>
+
+#include "alpha/compat/expected.hpp"  // alpha_detail::expected / unexpected
+#include "alpha/mem/spsc_queue.hpp"   // kCacheLine, SpscError
+
+namespace alpha::mem {
+
+/**
+ * @brief SPSC ring of variable-length records (owning).
+ */
+class SpscByteRing final {
+public:
+  /// @brief Record alignment (and header size).
+  static constexpr std::size_t kRecordAlign = 8;
+
+  /// @brief Per-record header stored in the ring.
+  struct RecordHeader {
+    std::uint32_t len;   ///< Payload bytes
+    std::uint32_t flags; ///< kPadding for filler records
+  };
+  static_assert(sizeof(RecordHeader) == kRecordAlign);
+
+  /// @brief Header flag: record only fills the ring tail (skipped by peek()).
+  static constexpr std::uint32_t kPadding = 1u;
+
+  /// @brief Default-constructed empty shell (use with factory).
+  SpscByteRing() noexcept = default;
+
+  /**
+   * @brief Factory: validates input and allocates once (no exceptions).
+   * @param capacity_pow2 Ring size in bytes (power-of-two, >= 2 * kRecordAlign).
+   * @return Constructed ring, or CapacityZero (too small) / CapacityNotPowerOfTwo / AllocationFailed.
+   */
+  static alpha_detail::expected<SpscByteRing, SpscError>
+  with_capacity(std::size_t capacity_pow2) noexcept;
+
+  SpscByteRing(const SpscByteRing&)            = delete; ///< Non-copyable
+  SpscByteRing& operator=(const SpscByteRing&) = delete; ///< Non-assignable
+
+  /// @brief Move constructor (avoid moving in-flight in RT).
+  SpscByteRing(SpscByteRing&& other) noexcept { move_from(std::move(other)); }
+
+  /// @brief Move assignment (avoid moving in-flight in RT).
+  SpscByteRing& operator=(SpscByteRing&& other) noexcept {
+    if (this != &other) move_from(std::move(other));
+    return *this;
+  }
+
+  // ---------------------------- Producer ----------------------------------
+
+  /**
+   * @brief Reserve @p len contiguous payload bytes (producer only).
+   * @return Writable span of exactly @p len bytes (8-byte aligned), or empty if the
+   *         ring lacks room. Nothing is visible to the consumer until commit().
+   */
+  std::span<std::byte> reserve(std::size_t len) noexcept {
+    if (len > max_record()) return {};
+    const std::size_t need = record_bytes(len);
+    const std::size_t pos  = static_cast<std::size_t>(tail_) & mask_;
+    const std::size_t room = capacity_ - pos;                 // contiguous bytes to the end
+    const std::size_t pad  = (need > room) ? room : 0;        // filler before wrapping to 0
+    if (!has_room(pad + need)) return {};
+
+    pend_pad_ = pad;
+    pend_max_ = len;
+    return {buf_ + (pad ? 0 : pos) + sizeof(RecordHeader), len};
+  }
+
+  /**
+   * @brief Publish the reserved record with @p used <= reserved payload bytes.
+   * @note Calling commit() without a successful reserve() is a contract violation.
+   */
+  void commit(std::size_t used) noexcept {
+    if (used > pend_max_) used = pend_max_;
+    std::uint64_t t = tail_;
+    if (pend_pad_) {
+      write_header(static_cast<std::size_t>(t) & mask_, pend_pad_ - sizeof(RecordHeader), kPadding);
+      t += pend_pad_;
+    }
+    write_header(static_cast<std::size_t>(t) & mask_, used, 0);
+    t += record_bytes(used);
+    tail_ = t;
+    pend_pad_ = pend_max_ = 0;
+    tail_pub_.store(t, std::memory_order_release);
+  }
+
+  /// @brief Copying convenience: reserve + memcpy + commit. False if full.
+  bool write(std::span<const std::byte> rec) noexcept {
+    auto dst = reserve(rec.size());
+    if (dst.data() == nullptr) return false;
+    if (!rec.empty()) std::memcpy(dst.data(), rec.data(), rec.size());
+    commit(rec.size());
+    return true;
+  }
+
+  // ---------------------------- Consumer ----------------------------------
+
+  /**
+   * @brief View the oldest record in place (consumer only); skips padding.
+   * @return Payload span (possibly zero-length), or an empty span with null data if
+   *         no record is available. Stays valid until release().
+   */
+  std::span<const std::byte> peek() noexcept {
+    std::uint64_t h = head_;
+    if (h == tail_cache_ && (tail_cache_ = tail_pub_.load(std::memory_order_acquire)) == h) return {};
+    auto hdr = read_header(static_cast<std::size_t>(h) & mask_);
+    if (hdr.flags & kPadding) {
+      // Padding and the record after it are published together.
+      h += sizeof(RecordHeader) + hdr.len;
+      hdr = read_header(static_cast<std::size_t>(h) & mask_);
+    }
+    const std::size_t off = static_cast<std::size_t>(h) & mask_;
+    peek_end_ = h + record_bytes(hdr.len);
+    return {buf_ + off + sizeof(RecordHeader), hdr.len};
+  }
+
+  /// @brief Free the record returned by the last peek() (consumer only).
+  void release() noexcept {
+    if (peek_end_ == head_) return;
+    head_ = peek_end_;
+    head_pub_.store(head_, std::memory_order_release);
+  }
+
+  // ---------------------------- Observers ---------------------------------
+
+  /// @brief True if no record is published (observer).
+  bool empty() const noexcept {
+    return head_pub_.load(std::memory_order_acquire) == tail_pub_.load(std::memory_order_acquire);
+  }
+
+  /// @brief Ring size in bytes (power-of-two).
+  std::size_t capacity() const noexcept { return capacity_; }
+
+  /// @brief Largest payload that always fits in an empty ring (capacity/2 - header).
+  std::size_t max_record() const noexcept { return capacity_ / 2 - sizeof(RecordHeader); }
+
+  /// @brief Approximate bytes in use, including headers and padding (not linearizable).
+  std::size_t approx_bytes() const noexcept {
+    return static_cast<std::size_t>(tail_pub_.load(std::memory_order_acquire) -
+                                    head_pub_.load(std::memory_order_acquire));
+  }
+
+  /// @brief Ring bytes a record with @p len payload bytes occupies.
+  static constexpr std::size_t record_bytes(std::size_t len) noexcept {
+    return (sizeof(RecordHeader) + len + kRecordAlign - 1) & ~(kRecordAlign - 1);
+  }
+
+private:
+  bool has_room(std::size_t total) noexcept {
+    if (tail_ + total - head_cache_ <= capacity_) return true;
+    head_cache_ = head_pub_.load(std::memory_order_acquire);
+    return tail_ + total - head_cache_ <= capacity_;
+  }
+
+  void write_header(std::size_t off, std::size_t len, std::uint32_t flags) noexcept {
+    const RecordHeader h{static_cast<std::uint32_t>(len), flags};
+    std::memcpy(buf_ + off, &h, sizeof h);
+  }
+
+  RecordHeader read_header(std::size_t off) const noexcept {
+    RecordHeader h;
+    std::memcpy(&h, buf_ + off, sizeof h);
+    return h;
+  }
+
+  void move_from(SpscByteRing&& other) noexcept;
+
+  // Producer line: published tail + producer-private state.
+  alignas(kCacheLine) std::atomic<std::uint64_t> tail_pub_{0}; ///< Published producer position
+  std::uint64_t tail_{0};         ///< Producer position (private copy of tail_pub_)
+  std::uint64_t head_cache_{0};   ///< Last head_pub_ seen by the producer
+  std::size_t   pend_pad_{0};     ///< Padding bytes of the open reservation
+  std::size_t   pend_max_{0};     ///< Payload bytes of the open reservation
+
+  // Consumer line: published head + consumer-private state.
+  alignas(kCacheLine) std::atomic<std::uint64_t> head_pub_{0}; ///< Published consumer position
+  std::uint64_t head_{0};         ///< Consumer position (private copy of head_pub_)
+  std::uint64_t tail_cache_{0};   ///< Last tail_pub_ seen by the consumer
+  std::uint64_t peek_end_{0};     ///< Position after the last peeked record
+
+  // Read-mostly metadata and owning storage
+  alignas(kCacheLine) std::byte* buf_ = nullptr; ///< Non-owning view into storage_
+  std::size_t capacity_ = 0;                     ///< Bytes (power-of-two)
+  std::size_t mask_     = 0;                     ///< capacity_-1
+  std::unique_ptr<std::byte[], void(*)(std::byte*)> storage_{nullptr, +[](std::byte*){}}; ///< Owning storage
+};
+
+} // namespace alpha::mem
@@ -1,3 +1,8 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
 namespace alpha::mem {
 
 /**
@@ -31,4 +36,4 @@ struct Packet final {
   std::uint32_t reserved{0};
 };
 
-} // namespace alpha::mem
\ No newline at end of file
+} // namespace alpha::mem
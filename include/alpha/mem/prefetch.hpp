@@ -0,0 +1,37 @@
+#pragma once
+/**
+ * @file prefetch.hpp
+ * @brief Portable software-prefetch hints for burst (group-prefetch) lookups.
+ *
+ * Hints only: they never fault and compile to nothing on unknown toolchains.
+ */
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <xmmintrin.h>
+#endif
+
+namespace alpha::mem {
+
+/// @brief Hint that @p p will be read soon (keep in all cache levels).
+inline void prefetch_read(const void* p) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(p, 0, 3);
+#elif defined(_MSC_VER)
+  _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+  (void)p;
+#endif
+}
+
+/// @brief Hint that @p p will be written soon.
+inline void prefetch_write(const void* p) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(p, 1, 3);
+#elif defined(_MSC_VER)
+  _mm_prefetch(static_cast<const char*>(p), _MM_HINT_T0);
+#else
+  (void)p;
+#endif
+}
+
+} // namespace alpha::mem
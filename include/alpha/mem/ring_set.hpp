@@ -0,0 +1,201 @@
+/**
+ * @file ring_set.hpp
+ * @brief One consumer polling many SPSC input rings (N RX threads → one worker).
+ *
+ * Design goals:
+ *  - Skip idle rings: producers set a per-ring bit in a shared "non-empty" bitmap
+ *    after publishing a burst; the worker only visits rings whose bit is set.
+ *  - Burst-fair draining: at most `burst` elements per ring per visit, a total
+ *    `budget` per poll, and a rotating start ring so no input is starved.
+ *  - Starvation tracking: consecutive polls a non-empty ring was not visited.
+ *  - One combined wait signal: when every ring is idle the worker spins, yields,
+ *    then sleeps on the bitmap itself (std::atomic::wait); the first producer to
+ *    flip it from zero wakes the worker.
+ *
+ * Bitmap protocol (lost-wakeup free):
+ *  - Producer: push burst (release on the ring) → notify(i) (fetch_or, always).
+ *  - Consumer: ring observed empty → clear bit (fetch_and) → re-check the ring and
+ *    set the bit again if something arrived in between.
+ *
+ * @tparam Ring SpscQueue<T> or SpscQueue<T, N> (uses front()/consume()).
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include "alpha/mem/spsc_queue.hpp"   // kCacheLine
+
+namespace alpha::mem {
+
+/// @brief Maximum rings per set (bit 63 of the bitmap is the wake bit).
+inline constexpr std::size_t kRingSetMaxRings = 63;
+
+/// @brief Worker polling/idle parameters.
+struct RingSetConfig {
+  std::uint32_t burst       = 32;   ///< Max elements drained from one ring per visit
+  std::uint32_t budget      = 256;  ///< Max elements per poll() across all rings
+  std::uint32_t spin_polls  = 64;   ///< Idle polls spent spinning before yielding
+  std::uint32_t yield_polls = 64;   ///< Idle polls spent yielding before sleeping
+};
+
+/// @brief Per-ring fairness counters (consumer-owned, read from the worker thread).
+struct RingStarvation {
+  std::uint64_t served      = 0;  ///< Elements delivered from this ring
+  std::uint32_t skipped     = 0;  ///< Consecutive polls the ring was pending but not visited
+  std::uint32_t max_skipped = 0;  ///< Worst `skipped` observed
+};
+
+/**
+ * @brief Non-owning set of input rings drained by a single worker.
+ *
+ * Thread roles: notify()/wake() from any producer/control thread; everything else
+ * from the owning worker only.
+ */
+template <class Ring>
+class RingSet final {
+public:
+  /// @brief Wake bit (not a ring): set by wake() to interrupt park().
+  static constexpr std::uint64_t kWakeBit = std::uint64_t{1} << kRingSetMaxRings;
+
+  explicit RingSet(RingSetConfig cfg = {}) noexcept : cfg_(cfg) {}
+
+  RingSet(const RingSet&)            = delete;
+  RingSet& operator=(const RingSet&) = delete;
+
+  /**
+   * @brief Register a ring (setup time only).
+   * @return Ring index for notify(), or -1 if the set is full.
+   */
+  int add(Ring& ring) noexcept {
+    if (count_ == kRingSetMaxRings) return -1;
+    rings_[count_] = &ring;
+    return static_cast<int>(count_++);
+  }
+
+  /// @brief Number of registered rings.
+  std::size_t size() const noexcept { return count_; }
+
+  // ---------------------------- Producer side -----------------------------
+
+  /// @brief Mark ring @p i non-empty after publishing a burst (any producer thread).
+  void notify(std::size_t i) noexcept {
+    const auto bit = std::uint64_t{1} << i;
+    // Always an RMW: it orders the ring publish before the bit (see file comment).
+    if (bits_.fetch_or(bit, std::memory_order_acq_rel) == 0) bits_.notify_one();
+  }
+
+  /// @brief Interrupt a parked worker (shutdown, control messages).
+  void wake() noexcept {
+    bits_.fetch_or(kWakeBit, std::memory_order_acq_rel);
+    bits_.notify_one();
+  }
+
+  // ---------------------------- Worker side -------------------------------
+
+  /**
+   * @brief Drain pending rings, burst-fair, within the poll budget.
+   * @param fn Called as fn(ring_index, element&) for each element, in ring order.
+   * @return Elements delivered (0 if all rings were idle).
+   */
+  template <class F>
+  std::size_t poll(F&& fn) {
+    std::uint64_t pending = bits_.load(std::memory_order_acquire) & ~kWakeBit;
+    if (pending == 0) return 0;
+
+    std::size_t budget = cfg_.budget;
+    std::size_t total  = 0;
+    while (pending != 0 && budget != 0) {
+      // Next pending ring at or after the cursor (wrapping): rotating start = fairness.
+      const std::uint64_t ahead = pending & (~std::uint64_t{0} << cursor_);
+      const auto i = static_cast<std::size_t>(std::countr_zero(ahead ? ahead : pending));
+      const std::uint64_t bit = std::uint64_t{1} << i;
+      pending &= ~bit;
+
+      Ring& ring = *rings_[i];
+      std::size_t n = 0;
+      const std::size_t limit = budget < cfg_.burst ? budget : cfg_.burst;
+      for (; n < limit; ++n) {
+        auto* e = ring.front();
+        if (e == nullptr) break;
+        fn(i, *e);
+        ring.consume();
+      }
+      if (n < limit) idle_ring(ring, bit); // drained: clear + re-check
+
+      stats_[i].served += n;
+      stats_[i].skipped = 0;
+      budget -= n;
+      total  += n;
+      cursor_ = (i + 1 == count_) ? 0 : i + 1;
+    }
+    // Pending rings the budget did not reach this round.
+    for (; pending != 0; pending &= pending - 1) {
+      auto& s = stats_[static_cast<std::size_t>(std::countr_zero(pending))];
+      if (++s.skipped > s.max_skipped) s.max_skipped = s.skipped;
+    }
+    idle_polls_ = total ? 0 : idle_polls_;
+    return total;
+  }
+
+  /**
+   * @brief Wait strategy for an idle poll: spin, then yield, then sleep on the bitmap.
+   * @note Call after poll() returned 0. Returns once any ring is notified or wake()
+   *       is called (clears the wake bit).
+   */
+  void idle() noexcept {
+    const std::uint32_t k = idle_polls_++;
+    if (k < cfg_.spin_polls) {
+      cpu_relax();
+    } else if (k < cfg_.spin_polls + cfg_.yield_polls) {
+      std::this_thread::yield();
+    } else {
+      park();
+    }
+  }
+
+  /// @brief Sleep until the bitmap becomes non-zero (one combined signal for all rings).
+  void park() noexcept {
+    bits_.wait(0, std::memory_order_acquire);
+    bits_.fetch_and(~kWakeBit, std::memory_order_acq_rel);
+    idle_polls_ = 0;
+  }
+
+  /// @brief Fairness counters for ring @p i.
+  const RingStarvation& starvation(std::size_t i) const noexcept { return stats_[i]; }
+
+  /// @brief Current non-empty bitmap (observer).
+  std::uint64_t pending() const noexcept { return bits_.load(std::memory_order_acquire) & ~kWakeBit; }
+
+private:
+  void idle_ring(Ring& ring, std::uint64_t bit) noexcept {
+    bits_.fetch_and(~bit, std::memory_order_acq_rel);
+    // A push may have landed after our last front() but seen the bit still set.
+    if (ring.front() != nullptr) bits_.fetch_or(bit, std::memory_order_acq_rel);
+  }
+
+  static void cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+  }
+
+  // Shared with producers: own cache line.
+  alignas(kCacheLine) std::atomic<std::uint64_t> bits_{0}; ///< Non-empty bitmap + wake bit
+
+  // Worker-private state.
+  alignas(kCacheLine) RingSetConfig                 cfg_;
+  std::size_t                                       count_      = 0;
+  std::size_t                                       cursor_     = 0;
+  std::uint32_t                                     idle_polls_ = 0;
+  std::array<Ring*, kRingSetMaxRings>               rings_{};
+  std::array<RingStarvation, kRingSetMaxRings>      stats_{};
+};
+
+} // namespace alpha::mem
@@ -11,8 +11,16 @@
  * Construction:
  *  - Use SpscQueue<T>::with_capacity(capacity_pow2) to build.
  *  - Constructor is noexcept and assumes validated inputs.
+ *  - SpscQueue<T, N> (N a power-of-two) has inline storage and a compile-time mask:
+ *    default-construct it in place (static, shared memory, arena). No heap, not movable.
+ *
+ * Zero-copy use:
+ *  - Producer: try_reserve() → construct in the slot → commit(), or emplace(args...).
+ *  - Consumer: front() → read in place → consume().
+ *  - Slots hold live objects only between publish and consume/pop (destroyed there).
  *
  * @tparam T Element type. Must be trivially copyable or nothrow-movable.
+ * @tparam N Capacity fixed at compile time, or 0 (default) for with_capacity().
  */
 #pragma once
 
@@ -50,20 +58,60 @@ struct SpscTraits {
     std::is_nothrow_move_constructible_v<T>;
 };
 
+namespace detail {
+
+/// @brief Inline slot storage; capacity and mask are compile-time constants.
+template <class T, std::size_t N>
+struct SpscStorage {
+  static constexpr std::size_t capacity() noexcept { return N; }
+  static constexpr std::size_t mask() noexcept { return N - 1; }
+  T*       data() noexcept       { return reinterpret_cast<T*>(bytes_); }
+  const T* data() const noexcept { return reinterpret_cast<const T*>(bytes_); }
+
+  alignas(alignof(T) > kCacheLine ? alignof(T) : kCacheLine) std::byte bytes_[N * sizeof(T)]; ///< Uninitialized slots
+};
+
+/// @brief Heap slot storage sized at setup (SpscQueue<T>::with_capacity).
+template <class T>
+struct SpscStorage<T, 0> {
+  SpscStorage() noexcept = default;
+  SpscStorage(SpscStorage&& o) noexcept { *this = std::move(o); }
+  SpscStorage& operator=(SpscStorage&& o) noexcept {
+    buf_ = o.buf_; capacity_ = o.capacity_; mask_ = o.mask_; storage_ = std::move(o.storage_);
+    o.buf_ = nullptr; o.capacity_ = 0; o.mask_ = 0;
+    return *this;
+  }
+
+  std::size_t capacity() const noexcept { return capacity_; }
+  std::size_t mask() const noexcept { return mask_; }
+  T*       data() noexcept       { return buf_; }
+  const T* data() const noexcept { return buf_; }
+
+  T*                                buf_      = nullptr; ///< Non-owning view into storage_
+  std::size_t                       capacity_ = 0;       ///< Capacity (power-of-two)
+  std::size_t                       mask_     = 0;       ///< capacity_-1
+  std::unique_ptr<T[], void(*)(T*)> storage_{nullptr, +[](T*){}}; ///< Owning storage
+};
+
+} // namespace detail
+
 /**
  * @brief Single-producer, single-consumer ring buffer (owning).
  *
  * @tparam T Element type.
+ * @tparam N Compile-time capacity (power-of-two), or 0 for runtime capacity.
  */
-template <class T>
+template <class T, std::size_t N = 0>
 class SpscQueue final {
   static_assert(std::atomic<std::size_t>::is_always_lock_free,
                 "std::atomic<size_t> must be lock-free on this target");
+  static_assert(N == 0 || (N >= 2 && (N & (N - 1)) == 0), "SpscQueue<T, N>: N must be a power-of-two >= 2");
+  static_assert(N == 0 || SpscTraits<T>::ok, "SpscQueue<T, N>: T must be trivially copyable or nothrow-movable");
 
 public:
   using value_type = T;
 
-  /// @brief Default-constructed empty shell (use with factory).
+  /// @brief Empty shell for N == 0 (use with factory); ready-to-use ring for N > 0.
   SpscQueue() noexcept = default;
 
   /**
@@ -72,7 +120,7 @@ public:
    * @return expected<SpscQueue, SpscError> constructed queue or error.
    */
   static alpha_detail::expected<SpscQueue, SpscError>
-  with_capacity(std::size_t capacity_pow2) noexcept {
+  with_capacity(std::size_t capacity_pow2) noexcept requires (N == 0) {
     if (capacity_pow2 == 0) {
       return alpha_detail::unexpected(SpscError::CapacityZero);
     }
@@ -94,25 +142,28 @@ public:
     }
 
     SpscQueue q;
-    q.buf_      = storage.get();
-    q.capacity_ = capacity_pow2;
-    q.mask_     = capacity_pow2 - 1;
-    q.storage_  = std::move(storage);
+    q.store_.buf_      = storage.get();
+    q.store_.capacity_ = capacity_pow2;
+    q.store_.mask_     = capacity_pow2 - 1;
+    q.store_.storage_  = std::move(storage);
     return q;
   }
 
   SpscQueue(const SpscQueue&)            = delete; ///< Non-copyable
   SpscQueue& operator=(const SpscQueue&) = delete; ///< Non-assignable
 
-  /// @brief Move constructor (avoid moving in-flight in RT).
-  SpscQueue(SpscQueue&& other) noexcept { move_from(std::move(other)); }
+  /// @brief Move constructor (avoid moving in-flight in RT). Heap-backed queues only.
+  SpscQueue(SpscQueue&& other) noexcept requires (N == 0) { move_from(std::move(other)); }
 
-  /// @brief Move assignment (avoid moving in-flight in RT).
-  SpscQueue& operator=(SpscQueue&& other) noexcept {
-    if (this != &other) move_from(std::move(other));
+  /// @brief Move assignment (avoid moving in-flight in RT). Heap-backed queues only.
+  SpscQueue& operator=(SpscQueue&& other) noexcept requires (N == 0) {
+    if (this != &other) { destroy_all(); move_from(std::move(other)); }
     return *this;
   }
 
+  /// @brief Destroys elements still in the ring (setup/teardown only).
+  ~SpscQueue() { destroy_all(); }
+
   /**
    * @brief Push by const reference.
    * @param v Element to copy.
@@ -120,11 +171,11 @@ public:
    */
   bool push(const T& v) noexcept {
     const std::size_t t = tail_.load(std::memory_order_relaxed);
-    const std::size_t n = (t + 1) & mask_;
+    const std::size_t n = (t + 1) & mask();
     if (n == head_.load(std::memory_order_acquire)) {
       return false; // full
     }
-    buf_[t] = v;
+    std::construct_at(buf() + t, v);
     tail_.store(n, std::memory_order_release);
     return true;
   }
@@ -136,11 +187,11 @@ public:
    */
   bool push(T&& v) noexcept(std::is_nothrow_move_constructible_v<T>) {
     const std::size_t t = tail_.load(std::memory_order_relaxed);
-    const std::size_t n = (t + 1) & mask_;
+    const std::size_t n = (t + 1) & mask();
     if (n == head_.load(std::memory_order_acquire)) {
       return false; // full
     }
-    buf_[t] = std::move(v);
+    std::construct_at(buf() + t, std::move(v));
     tail_.store(n, std::memory_order_release);
     return true;
   }
@@ -156,11 +207,63 @@ public:
     if (h == tail_.load(std::memory_order_acquire)) {
       return false; // empty
     }
-    out = std::move(buf_[h]);
-    head_.store((h + 1) & mask_, std::memory_order_release);
+    out = std::move(buf()[h]);
+    std::destroy_at(buf() + h);
+    head_.store((h + 1) & mask(), std::memory_order_release);
     return true;
   }
 
+  /**
+   * @brief Reserve the next slot for in-place construction (producer only).
+   * @return Uninitialized slot storage, or nullptr if full. Construct a T there
+   *         (placement new / std::construct_at), then call commit().
+   */
+  T* try_reserve() noexcept {
+    const std::size_t t = tail_.load(std::memory_order_relaxed);
+    if (((t + 1) & mask()) == head_.load(std::memory_order_acquire)) {
+      return nullptr; // full
+    }
+    return buf() + t;
+  }
+
+  /// @brief Publish the slot returned by the last successful try_reserve().
+  void commit() noexcept {
+    const std::size_t t = tail_.load(std::memory_order_relaxed);
+    tail_.store((t + 1) & mask(), std::memory_order_release);
+  }
+
+  /**
+   * @brief Construct an element directly in ring memory.
+   * @return false if queue is full (no object is constructed).
+   */
+  template <class... Args>
+  bool emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+    T* slot = try_reserve();
+    if (slot == nullptr) return false;
+    std::construct_at(slot, std::forward<Args>(args)...);
+    commit();
+    return true;
+  }
+
+  /**
+   * @brief Oldest element, read in place (consumer only).
+   * @return nullptr if empty. Valid until consume().
+   */
+  T* front() noexcept {
+    const std::size_t h = head_.load(std::memory_order_relaxed);
+    if (h == tail_.load(std::memory_order_acquire)) {
+      return nullptr; // empty
+    }
+    return buf() + h;
+  }
+
+  /// @brief Destroy the element returned by front() and free its slot.
+  void consume() noexcept {
+    const std::size_t h = head_.load(std::memory_order_relaxed);
+    std::destroy_at(buf() + h);
+    head_.store((h + 1) & mask(), std::memory_order_release);
+  }
+
   /// @brief True if queue is empty (observer).
   bool empty() const noexcept {
     return head_.load(std::memory_order_acquire) ==
@@ -170,42 +273,53 @@ public:
   /// @brief True if queue is full (observer).
   bool full() const noexcept {
     const auto t = tail_.load(std::memory_order_acquire);
-    return ((t + 1) & mask_) == head_.load(std::memory_order_acquire);
+    return ((t + 1) & mask()) == head_.load(std::memory_order_acquire);
   }
 
   /// @brief Capacity (power-of-two).
-  std::size_t capacity() const noexcept { return capacity_; }
+  std::size_t capacity() const noexcept { return store_.capacity(); }
 
   /// @brief Approximate size (not linearizable across threads).
   std::size_t approx_size() const noexcept {
     const auto t = tail_.load(std::memory_order_acquire);
     const auto h = head_.load(std::memory_order_acquire);
-    return (t + capacity_ - h) & mask_;
+    return (t + capacity() - h) & mask();
   }
 
 private:
+  /// @brief Destroy published-but-unconsumed elements (no-op for trivial T).
+  void destroy_all() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+      if (buf() == nullptr) return;
+      const std::size_t t = tail_.load(std::memory_order_acquire);
+      for (std::size_t h = head_.load(std::memory_order_relaxed); h != t; h = (h + 1) & mask()) {
+        std::destroy_at(buf() + h);
+      }
+    }
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+  }
+
   /// @brief Helper to implement noexcept move.
   void move_from(SpscQueue&& other) noexcept {
     head_.store(other.head_.load(std::memory_order_relaxed), std::memory_order_relaxed);
     tail_.store(other.tail_.load(std::memory_order_relaxed), std::memory_order_relaxed);
-    buf_       = other.buf_;
-    capacity_  = other.capacity_;
-    mask_      = other.mask_;
-    storage_   = std::move(other.storage_);
-    other.buf_ = nullptr;
-    other.capacity_ = 0;
-    other.mask_ = 0;
+    store_ = std::move(other.store_);
+    other.head_.store(0, std::memory_order_relaxed);
+    other.tail_.store(0, std::memory_order_relaxed);
   }
 
+  /// @brief Slot array (inline for N > 0: no pointer load).
+  T* buf() noexcept { return store_.data(); }
+  /// @brief Index mask (an immediate for N > 0).
+  std::size_t mask() const noexcept { return store_.mask(); }
+
   // Producer/consumer indices on separate cache lines (avoid false sharing)
   alignas(kCacheLine) std::atomic<std::size_t> head_{0}; ///< Consumer index
   alignas(kCacheLine) std::atomic<std::size_t> tail_{0}; ///< Producer index
 
-  // Read-mostly metadata and owning storage
-  alignas(kCacheLine) T*                            buf_      = nullptr; ///< Non-owning view into storage_
-  std::size_t                                       capacity_ = 0;      ///< Capacity (power-of-two)
-  std::size_t                                       mask_     = 0;      ///< capacity_-1
-  std::unique_ptr<T[], void(*)(T*)>                 storage_{nullptr, +[](T*){}}; ///< Owning storage
+  // Read-mostly metadata and (owning or inline) storage
+  alignas(kCacheLine) detail::SpscStorage<T, N> store_; ///< Slots + capacity/mask
 };
 
 } // namespace alpha::mem
@@ -0,0 +1,141 @@
+/**
+ * @file stage_ring.hpp
+ * @brief Single preallocated ring shared by a pipeline of stages (Disruptor-style).
+ *
+ * The producer (ingress) claims slots and publishes them; stage 0 (e.g. path
+ * selection) processes them in place, then stage 1 (QoS), and so on. A stage
+ * only sees slots the previous stage has released (its sequence barrier); the
+ * producer only reuses slots the last stage has released. Packets never move
+ * between per-stage rings, so there is no copy and no extra cache miss per hop.
+ *
+ * Design goals:
+ *  - One writer per sequence: the producer owns the cursor, stage k owns seq[k].
+ *  - Batch claims and batch releases: one acquire/release pair per batch.
+ *  - Sequences are monotonic 64-bit counters on separate cache lines; each side
+ *    caches the sequence it waits on and reloads it only when the cache cannot
+ *    fill the requested batch.
+ *  - Non-blocking: available()/try_claim() return 0 when there is nothing to do;
+ *    the caller's run loop decides whether to spin, yield or sleep.
+ *
+ * Stage loop:
+ *   auto b = ring.available(k, max);         // [b.first, b.first + b.count)
+ *   for (i < b.count) process(ring[b.first + i]);
+ *   ring.release(k, b);
+ *
+ * @tparam T      Slot type (default-constructed once; reused in place).
+ * @tparam N      Slot count (power-of-two).
+ * @tparam Stages Number of consumer stages (>= 1), run in order.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "alpha/mem/spsc_queue.hpp"   // kCacheLine
+
+namespace alpha::mem {
+
+/// @brief Range of sequences [first, first + count) handed to the producer or a stage.
+struct SeqBatch {
+  std::uint64_t first = 0;
+  std::size_t   count = 0;
+};
+
+template <class T, std::size_t N, std::size_t Stages>
+class StageRing final {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "StageRing: N must be a power-of-two >= 2");
+  static_assert(Stages >= 1, "StageRing: need at least one stage");
+  static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+
+public:
+  static constexpr std::size_t kCapacity = N;
+  static constexpr std::size_t kStages   = Stages;
+
+  StageRing() noexcept = default;
+  StageRing(const StageRing&)            = delete;
+  StageRing& operator=(const StageRing&) = delete;
+
+  /// @brief Slot for sequence @p seq (valid while the caller holds it in a batch).
+  T&       operator[](std::uint64_t seq) noexcept       { return slots_[static_cast<std::size_t>(seq) & (N - 1)]; }
+  const T& operator[](std::uint64_t seq) const noexcept { return slots_[static_cast<std::size_t>(seq) & (N - 1)]; }
+
+  // ---------------------------- Producer ----------------------------------
+
+  /**
+   * @brief Claim up to @p max free slots (producer only).
+   * @return Claimed batch; count == 0 if the last stage has not freed any slot.
+   */
+  SeqBatch try_claim(std::size_t max) noexcept {
+    std::uint64_t free = N - (next_ - gate_cache_);
+    if (free < max) {
+      gate_cache_ = seq_[Stages - 1].v.load(std::memory_order_acquire);
+      free = N - (next_ - gate_cache_);
+    }
+    const std::size_t n = free < max ? static_cast<std::size_t>(free) : max;
+    const SeqBatch b{next_, n};
+    next_ += n;
+    return b;
+  }
+
+  /// @brief Make a claimed batch visible to stage 0 (batches publish in claim order).
+  void publish(const SeqBatch& b) noexcept {
+    cursor_.v.store(b.first + b.count, std::memory_order_release);
+  }
+
+  // ---------------------------- Stages ------------------------------------
+
+  /**
+   * @brief Slots ready for stage @p k (released by stage k-1, or published for k == 0).
+   * @param max Upper bound on the batch size.
+   */
+  SeqBatch available(std::size_t k, std::size_t max) noexcept {
+    Local& l = local_[k];
+    if (l.barrier_cache - l.next < max) {
+      const auto& barrier = (k == 0) ? cursor_ : seq_[k - 1];
+      l.barrier_cache = barrier.v.load(std::memory_order_acquire);
+    }
+    const std::uint64_t ready = l.barrier_cache - l.next;
+    const std::size_t n = ready < max ? static_cast<std::size_t>(ready) : max;
+    return {l.next, n};
+  }
+
+  /// @brief Hand a processed batch to stage k+1 (or back to the producer for the last stage).
+  void release(std::size_t k, const SeqBatch& b) noexcept {
+    local_[k].next = b.first + b.count;
+    seq_[k].v.store(local_[k].next, std::memory_order_release);
+  }
+
+  // ---------------------------- Observers ---------------------------------
+
+  /// @brief Published sequence (exclusive upper bound).
+  std::uint64_t cursor() const noexcept { return cursor_.v.load(std::memory_order_acquire); }
+
+  /// @brief Sequence stage @p k has released up to (exclusive).
+  std::uint64_t stage_seq(std::size_t k) const noexcept { return seq_[k].v.load(std::memory_order_acquire); }
+
+  /// @brief Slots in flight anywhere in the pipeline (approximate).
+  std::size_t in_flight() const noexcept {
+    return static_cast<std::size_t>(cursor() - stage_seq(Stages - 1));
+  }
+
+private:
+  struct alignas(kCacheLine) Seq {
+    std::atomic<std::uint64_t> v{0};
+  };
+  /// Stage-private cursor state (owned by the stage thread).
+  struct alignas(kCacheLine) Local {
+    std::uint64_t next          = 0; ///< Next sequence this stage processes
+    std::uint64_t barrier_cache = 0; ///< Last barrier value seen
+  };
+
+  Seq                          cursor_;                 ///< Producer publish sequence
+  std::array<Seq, Stages>      seq_{};                  ///< Per-stage release sequences
+  std::array<Local, Stages>    local_{};                ///< Per-stage private state
+  alignas(kCacheLine) std::uint64_t next_       = 0;   ///< Producer: next sequence to claim
+  std::uint64_t                     gate_cache_ = 0;   ///< Producer: last-stage sequence seen
+  alignas(kCacheLine) std::array<T, N> slots_{};        ///< Preallocated slots
+};
+
+} // namespace alpha::mem
@@ -0,0 +1,132 @@
+#pragma once
+/**
+ * @file clock.hpp
+ * @brief Cheap monotonic timestamps for the data plane (calibrated TSC) and a per-burst coarse clock.
+ * @note x86-64 (rdtsc, invariant TSC required) and AArch64 (cntvct_el0) implemented;
+ *       everything else, or a TSC that fails the checks, falls back to steady_clock.
+ *
+ * TscClock::now() returns steady_clock time points: ticks are mapped onto
+ * CLOCK_MONOTONIC at calibration, so TSC and vDSO timestamps can be mixed
+ * (failover hysteresis, handoff across restarts).
+ *
+ * Startup (before workers run):   alpha::os::TscClock::calibrate();
+ * Worker, once per burst:         clk.refresh();   ... clk.now() for every packet
+ */
+
+#include <chrono>
+#include <cstdint>
+
+namespace alpha::os {
+
+/// @brief Result of TSC calibration (observability; not needed on the hot path).
+struct TscCalibration {
+    bool          invariant{false};  ///< CPU reports a constant-rate, non-stop counter
+    bool          enabled{false};    ///< now() reads the counter (else steady_clock)
+    std::uint64_t hz{0};             ///< Measured (or architected) counter frequency
+};
+
+/**
+ * @class TscClock
+ * @brief Chrono-compatible clock over the CPU timestamp counter.
+ */
+class TscClock final {
+public:
+    using duration   = std::chrono::steady_clock::duration;
+    using rep        = duration::rep;
+    using period     = duration::period;
+    using time_point = std::chrono::steady_clock::time_point;
+    static constexpr bool is_steady = true;
+
+    /**
+     * @brief Measure the counter against CLOCK_MONOTONIC over @p window and enable it.
+     * @note Call once at startup, before any thread uses now() (the anchor is plain
+     *       data). Leaves the steady_clock fallback in place if the counter is unusable.
+     */
+    static TscCalibration calibrate(std::chrono::milliseconds window = std::chrono::milliseconds{20}) noexcept;
+
+    /// @brief Current time; steady_clock::now() until calibrate() enabled the counter.
+    static time_point now() noexcept {
+        if (!state_.enabled) return std::chrono::steady_clock::now();
+        const std::uint64_t t = read_counter();
+        // Clamp a core whose counter trails the anchor by a few ticks: stay monotonic.
+        return time_point{duration{state_.ns0 + (t > state_.tsc0 ? to_ns(t - state_.tsc0) : 0)}};
+    }
+
+    /// @brief Raw counter value (0 on platforms without one).
+    static std::uint64_t read_counter() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+        std::uint64_t v;
+        asm volatile("mrs %0, cntvct_el0" : "=r"(v));
+        return v;
+#else
+        return 0;
+#endif
+    }
+
+    /// @brief Last calibration result.
+    static TscCalibration calibration() noexcept { return state_.cal; }
+
+    /// @brief 32.32 fixed-point multiplier for a counter ticking every @p ns_per_tick ns.
+    static constexpr std::uint64_t mult_for(double ns_per_tick) noexcept {
+        return static_cast<std::uint64_t>(ns_per_tick * 4294967296.0);
+    }
+
+    /**
+     * @brief Ticks → ns with a 32.32 multiplier.
+     * @note The product is 128-bit: mult is ns/tick · 2^32, which for a 25 MHz counter
+     *       (AArch64 cntvct_el0) is ~1.7e11, so a 64-bit product wraps within one second.
+     *       Without a native 128-bit type (MSVC) it is formed from 32-bit halves; both
+     *       give the same low 64 bits of (ticks · mult) >> 32.
+     */
+    static constexpr std::int64_t ticks_to_ns(std::uint64_t ticks, std::uint64_t mult) noexcept {
+#if defined(__SIZEOF_INT128__)
+        return static_cast<std::int64_t>((static_cast<u128>(ticks) * mult) >> 32);
+#else
+        const std::uint64_t th = ticks >> 32, tl = ticks & 0xFFFFFFFFu;
+        const std::uint64_t mh = mult >> 32,  ml = mult & 0xFFFFFFFFu;
+        return static_cast<std::int64_t>((th * mh << 32) + th * ml + tl * mh + (tl * ml >> 32));
+#endif
+    }
+
+private:
+    struct State {
+        bool          enabled{false};
+        std::uint64_t tsc0{0};     ///< Counter at the calibration anchor
+        std::int64_t  ns0{0};      ///< CLOCK_MONOTONIC at the anchor (ns)
+        std::uint64_t mult{0};     ///< ns per tick, 32.32 fixed point
+        TscCalibration cal{};
+    };
+
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 u128;
+#endif
+
+    static std::int64_t to_ns(std::uint64_t ticks) noexcept { return ticks_to_ns(ticks, state_.mult); }
+
+    static State state_;
+};
+
+/**
+ * @class BurstClock
+ * @brief Coarse per-worker "now": one counter read per burst, plain loads per packet.
+ * @note Owned by one worker thread; all packets of a burst share its timestamp.
+ */
+class BurstClock final {
+public:
+    using time_point = TscClock::time_point;
+
+    BurstClock() noexcept : now_(TscClock::now()) {}
+
+    /// @brief Sample the clock (call at the start of each burst).
+    time_point refresh() noexcept { return now_ = TscClock::now(); }
+
+    /// @brief Timestamp of the current burst.
+    time_point now() const noexcept { return now_; }
+
+private:
+    time_point now_;
+};
+
+} // namespace alpha::os
@@ -0,0 +1,158 @@
+#pragma once
+/**
+ * @file handoff.hpp
+ * @brief Hitless restart: pass I/O descriptors and shared-memory state to a new process.
+ * @note Linux implemented (memfd + SCM_RIGHTS over a Unix socket). On other targets the API
+ *       links but every call fails with HandoffError::Unsupported (handoff_unsupported.cpp).
+ *
+ * Protocol (old = running binary, new = upgraded binary):
+ *  1. new connects to the handoff socket.
+ *  2. old sends Offer: the state region memfd plus tagged I/O descriptors.
+ *  3. new maps the region, validates its layout and replies Ready.
+ *  4. old stops reading, drains in-flight packets, writes final snapshots and sends Commit.
+ *  5. new adopts the state in place and starts I/O; old exits.
+ *
+ * Flow tables are built directly inside the region (see FlowTable's storage
+ * constructor), so step 5 is a remap rather than a copy. Steady-clock time points
+ * (failover hysteresis) stay valid: CLOCK_MONOTONIC is system-wide.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "alpha/compat/expected.hpp"  // alpha_detail::expected / unexpected
+
+namespace alpha::os {
+
+/// @brief Errors reported by handoff setup (never on the data path).
+enum class HandoffError : std::uint8_t {
+    Unsupported = 1, ///< Platform lacks memfd/SCM_RIGHTS
+    SystemError,     ///< A syscall failed (see errno)
+    Protocol,        ///< Unexpected or malformed message
+    LayoutMismatch,  ///< Region magic/version does not match this binary
+    RegionFull,      ///< Section allocation exceeds region capacity
+    NotFound         ///< Requested section absent
+};
+
+/// @brief Well-known section kinds; applications may use values >= App.
+namespace handoff_kind {
+    inline constexpr std::uint32_t FlowTable        = 1; ///< FlowEntry slots, index = worker
+    inline constexpr std::uint32_t RegistrySnapshot = 2; ///< ServiceRegistry::serializeSnapshot bytes
+    inline constexpr std::uint32_t App              = 0x100;
+}
+
+/// @brief Bumped whenever the region header or a well-known section layout changes.
+inline constexpr std::uint32_t kHandoffLayoutVersion = 1;
+
+/// @brief Maximum sections and passed descriptors per handoff.
+inline constexpr std::size_t kHandoffMaxSections = 32;
+inline constexpr std::size_t kHandoffMaxFds      = 16;
+
+/// @brief An I/O descriptor tagged with an application-defined role.
+struct HandoffFd {
+    std::uint32_t role{0};
+    int           fd{-1};
+};
+
+/**
+ * @class HandoffRegion
+ * @brief memfd-backed shared region with a small section directory.
+ *
+ * Sections are bump-allocated at 64-byte alignment and never freed; the old
+ * process creates them at startup, the new process finds them by (kind, index).
+ */
+class HandoffRegion {
+public:
+    HandoffRegion() noexcept = default;
+    ~HandoffRegion();
+
+    HandoffRegion(const HandoffRegion&)            = delete;
+    HandoffRegion& operator=(const HandoffRegion&) = delete;
+    HandoffRegion(HandoffRegion&& other) noexcept;
+    HandoffRegion& operator=(HandoffRegion&& other) noexcept;
+
+    /// @brief Create and map a fresh region of @p bytes (rounded up to a page).
+    static alpha_detail::expected<HandoffRegion, HandoffError> create(std::size_t bytes);
+
+    /// @brief Map a region received from the previous process (takes ownership of @p fd).
+    static alpha_detail::expected<HandoffRegion, HandoffError> attach(int fd);
+
+    /// @brief Reserve a zero-filled section. Fails if (kind, index) exists or space runs out.
+    alpha_detail::expected<std::span<std::byte>, HandoffError>
+    allocate(std::uint32_t kind, std::uint32_t index, std::size_t bytes) noexcept;
+
+    /// @brief Look up a section created by allocate().
+    alpha_detail::expected<std::span<std::byte>, HandoffError>
+    find(std::uint32_t kind, std::uint32_t index) const noexcept;
+
+    /// @brief Typed view over a section (T must be trivially copyable).
+    template <class T>
+    static std::span<T> as(std::span<std::byte> bytes) noexcept {
+        return {reinterpret_cast<T*>(bytes.data()), bytes.size() / sizeof(T)};
+    }
+
+    int         fd()   const noexcept { return fd_; }
+    std::size_t size() const noexcept { return size_; }
+
+private:
+    void reset() noexcept;
+
+    int         fd_{-1};
+    void*       base_{nullptr};
+    std::size_t size_{0};
+};
+
+/**
+ * @class HandoffChannel
+ * @brief Connected Unix stream socket carrying the handoff protocol.
+ */
+class HandoffChannel {
+public:
+    /// @brief Protocol messages.
+    enum class Op : std::uint32_t { Offer = 1, Ready, Commit };
+
+    /// @brief Descriptors received with an Offer.
+    struct Offer {
+        int                    region_fd{-1};
+        std::vector<HandoffFd> fds;
+    };
+
+    HandoffChannel() noexcept = default;
+    explicit HandoffChannel(int fd) noexcept : fd_(fd) {}
+    ~HandoffChannel();
+
+    HandoffChannel(const HandoffChannel&)            = delete;
+    HandoffChannel& operator=(const HandoffChannel&) = delete;
+    HandoffChannel(HandoffChannel&& other) noexcept : fd_(other.fd_) { other.fd_ = -1; }
+    HandoffChannel& operator=(HandoffChannel&& other) noexcept;
+
+    /// @brief Old process: bind+listen on @p path; returns the listening descriptor.
+    static alpha_detail::expected<int, HandoffError> listen(const std::string& path);
+    /// @brief Old process: accept one upgrade connection.
+    static alpha_detail::expected<HandoffChannel, HandoffError> accept(int listen_fd);
+    /// @brief New process: connect to the running process.
+    static alpha_detail::expected<HandoffChannel, HandoffError> connect(const std::string& path);
+
+    /// @brief Old → new: region plus tagged descriptors (duplicated by the kernel).
+    alpha_detail::expected<void, HandoffError>
+    send_offer(const HandoffRegion& region, std::span<const HandoffFd> fds) noexcept;
+
+    /// @brief New: receive the Offer (caller owns the returned descriptors).
+    alpha_detail::expected<Offer, HandoffError> recv_offer();
+
+    /// @brief Send a descriptor-less message (Ready / Commit).
+    alpha_detail::expected<void, HandoffError> send(Op op) noexcept;
+
+    /// @brief Block until @p op arrives; any other message is a protocol error.
+    alpha_detail::expected<void, HandoffError> expect(Op op) noexcept;
+
+    int fd() const noexcept { return fd_; }
+
+private:
+    int fd_{-1};
+};
+
+} // namespace alpha::os
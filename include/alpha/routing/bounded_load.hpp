@@ -0,0 +1,70 @@
+#pragma once
+/**
+ * @file bounded_load.hpp
+ * @brief Consistent hashing with bounded loads: sticky flow placement with a hard imbalance cap.
+ * @details Every candidate path owns kReplicas points on a 32-bit hash ring. A new flow
+ *          starts at its (remixed) flow hash and walks the ring clockwise; the first
+ *          healthy path whose active-flow count is below
+ *
+ *              cap = ceil((1 + epsilon) * (flows + 1) / healthy_paths)
+ *
+ *          takes it. Without overload this is plain consistent hashing (adding or
+ *          removing a path moves only its share); a popular region of the ring spills
+ *          onto the next paths instead of piling onto one. Some path is always below
+ *          the cap, so the walk terminates within one lap.
+ *
+ *          Loads come from the worker's FlowTable (FlowTable::track_paths()), so the
+ *          bound holds per worker; with RSS spreading flows across workers it holds
+ *          for the sum as well. The policy places new flows only: pinned flows keep
+ *          their path through the flow table.
+ *
+ *          Worker miss path:
+ *              if (!flows.find(key)) flows.insert(key, pkt.flow_hash, policy.choose(cands, pkt));
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "alpha/routing/flow_table.hpp"
+#include "alpha/routing/path_selection.hpp"
+
+namespace alpha::routing {
+
+struct BoundedLoadConfig final {
+    std::uint32_t epsilon_ppm{250'000};   ///< Allowed excess over the average load (0.25)
+    bool          skip_unhealthy{true};
+};
+
+/**
+ * @class BoundedLoadPolicy
+ * @brief Same choose() shape as the other policies; reads loads from one worker's FlowTable.
+ * @note Owned by that worker (the counters are single-writer plain data).
+ */
+class BoundedLoadPolicy final {
+public:
+    /// @brief Ring points per path (more points, smoother shares; cost is linear).
+    static constexpr std::uint32_t kReplicas = 4;
+
+    /// @brief Candidates beyond this many are not considered.
+    static constexpr std::size_t kMaxCandidates = 64;
+
+    /// @param flows Table whose per-path counters bound the placement (must call track_paths()).
+    explicit BoundedLoadPolicy(const FlowTable& flows, BoundedLoadConfig cfg = {}) noexcept;
+
+    /// @brief Path for a new flow: first path on the ring below the load cap.
+    PathId choose(std::span<const CandidateRef> cands, const PacketContext& pkt) noexcept;
+
+    /// @brief Load cap for @p flows active flows over @p paths eligible paths (counts the new flow).
+    std::uint32_t cap(std::uint64_t flows, std::uint32_t paths) const noexcept;
+
+    /// @brief Placements that skipped the ring owner because it was full.
+    std::uint64_t spilled() const noexcept { return spilled_; }
+
+private:
+    const FlowTable*  flows_;
+    BoundedLoadConfig cfg_{};
+    std::uint64_t     spilled_{0};
+};
+
+} // namespace alpha::routing
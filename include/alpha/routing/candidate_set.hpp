@@ -0,0 +1,212 @@
+#pragma once
+/**
+ * @file candidate_set.hpp
+ * @brief Precompiled per-service candidate arrays over the MetricsTable arena.
+ * @details The control plane assigns every PoP a stable PathId (its slot in the
+ *          MetricsTable) and, per registry version, lays out each service's
+ *          candidates as a contiguous, cache-line-aligned CandidateRef array, once
+ *          per metrics buffer. The data plane goes service handle → span with a
+ *          single 8-byte load; no per-packet span building.
+ *
+ * Data plane, per burst:
+ *   auto cs = compiler.current();                 // RCU pin (refresh per burst or on version change)
+ *   const auto e = table.enter(worker);
+ *   auto cands = cs->candidates(cs->index().find(id), e);
+ *   PathId p = policy.choose(cands, ctx);
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "alpha/routing/metrics_table.hpp"
+#include "alpha/routing/path_selection.hpp"
+#include "alpha/routing/service_index.hpp"
+#include "alpha/routing/service_registry.hpp"
+
+namespace alpha::routing {
+
+/// Returned for PoPs without a metrics slot.
+inline constexpr PathId kInvalidPath = 0xFFFFFFFFu;
+
+/**
+ * @class CandidateSet
+ * @brief Immutable, compiled candidate arrays for one registry version.
+ *
+ * Candidates per service follow the registry's PoP order; Down PoPs are left out.
+ */
+class CandidateSet final {
+public:
+    /// @brief CandidateRefs per cache line (arrays start on a line boundary).
+    static constexpr std::size_t kRefsPerLine = ALPHA_CACHELINE / sizeof(CandidateRef);
+
+    /**
+     * @brief Compile arrays for @p index, resolving PoP ids through @p path_of.
+     * @param path_of Called as path_of(pop_id) → PathId, kInvalidPath to skip the PoP.
+     */
+    template <class PathOf>
+    static std::shared_ptr<const CandidateSet>
+    compile(std::shared_ptr<const ServiceIndex> index, const MetricsTable& table, PathOf&& path_of);
+
+    /**
+     * @brief Candidates of service @p h against metrics epoch @p epoch (one load).
+     * @return Empty span for kInvalidService or a service without eligible PoPs.
+     */
+    std::span<const CandidateRef> candidates(ServiceHandle h, std::uint64_t epoch) const noexcept {
+        if (h >= services_) return {};
+        const Range r = ranges_[h];
+        return {refs_.get() + (epoch % MetricsTable::kBuffers) * stride_ + r.off, r.count};
+    }
+
+    /// @brief PathIds of service @p h (buffer-independent, control-plane view).
+    std::span<const PathId> paths(ServiceHandle h) const noexcept {
+        if (h >= services_) return {};
+        return {path_ids_.data() + ranges_[h].off, ranges_[h].count};
+    }
+
+    /// @brief Index the arrays were compiled from (id → handle lookups).
+    const ServiceIndex& index() const noexcept { return *index_; }
+
+    /// @brief Registry version of the compiled index.
+    std::uint64_t version() const noexcept { return index_->version(); }
+
+private:
+    struct Range {
+        std::uint32_t off{0};   ///< First CandidateRef (multiple of kRefsPerLine)
+        std::uint32_t count{0};
+    };
+
+    CandidateSet() = default;
+
+    void layout(const MetricsTable& table);
+
+    struct FreeLines {
+        void operator()(CandidateRef* p) const noexcept;
+    };
+
+    std::shared_ptr<const ServiceIndex> index_;
+    std::size_t                         services_{0};
+    std::size_t                         stride_{0};     ///< Refs per metrics buffer
+    std::vector<Range>                  ranges_;
+    std::vector<PathId>                 path_ids_;      ///< Same layout as one buffer's refs
+    std::unique_ptr<CandidateRef[], FreeLines> refs_; ///< kBuffers * stride_, line-aligned
+};
+
+/**
+ * @class CandidateCompiler
+ * @brief Control-plane owner of PoP → PathId assignment and the published CandidateSet.
+ *
+ * PathIds are handed out on first sight and kept while the registry lists the PoP,
+ * so metrics slots do not move when services change. When a PoP leaves the registry
+ * its PathId retires:
+ *   - reset_updates() hands out a default (unhealthy) update for it, which the caller
+ *     includes in its next MetricsTable::publish();
+ *   - a later refresh() frees the id once that reset has been published and every
+ *     CandidateSet compiled before the PoP left has been released.
+ * A PoP that takes over a freed id therefore reads healthy == false until its own
+ * first publish. Workers must drop FlowTable pins on a retired id (erase_if on the
+ * path) when they move to a set without it, or those flows follow the id to the new PoP.
+ * PoPs beyond the table size are skipped and counted.
+ */
+class CandidateCompiler final {
+public:
+    explicit CandidateCompiler(const MetricsTable& table);
+
+    /**
+     * @brief Recompile and publish if the registry version changed (control plane).
+     * @return true if a new CandidateSet was published.
+     */
+    bool refresh(const ServiceRegistry& reg);
+
+    /// @brief Current compiled set (RCU pin; any thread).
+    std::shared_ptr<const CandidateSet> current() const noexcept {
+        return std::atomic_load_explicit(&current_, std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Append an unhealthy default update for every retired PathId not reset yet.
+     * @details Call once per tick before MetricsTable::publish() and publish the result
+     *          (keep it for the retry if publish() stalls): the ids are not reused before
+     *          the table's epoch moves past the call.
+     */
+    void reset_updates(std::vector<PathUpdate>& out);
+
+    /// @brief PathId assigned to @p pop_id, or kInvalidPath.
+    PathId path_of(std::string_view pop_id) const;
+
+    /// @brief PathIds in use: held by a listed PoP or waiting for older sets to retire.
+    std::size_t assigned() const noexcept { return next_ - free_.size(); }
+
+    /// @brief PoPs skipped because the metrics table was full.
+    std::uint64_t overflowed() const noexcept { return overflow_; }
+
+private:
+    using PathMap = std::unordered_map<std::string, PathId, ServiceRegistry::SKeyHash, ServiceRegistry::SKeyEq>;
+
+    static constexpr std::uint64_t kNotReset = ~std::uint64_t{0};
+
+    /// PathId of a PoP dropped by registry version @c version (older sets may still use it).
+    struct Retiring {
+        PathId        id;
+        std::uint64_t version;
+        std::uint64_t reset_epoch{kNotReset};   ///< Table epoch when reset_updates() handed it out
+    };
+
+    /// A replaced set; readers may still pin it.
+    struct Replaced {
+        std::weak_ptr<const CandidateSet> set;
+        std::uint64_t                     version;
+    };
+
+    PathId intern(const std::string& pop_id);
+
+    /// Free retiring PathIds that are reset and no live set can reference any more.
+    void reclaim();
+
+    /// Move PathIds of PoPs absent from @p next to retiring_.
+    void retire_absent(const ServiceIndex& next);
+
+    const MetricsTable&                      table_;
+    PathMap                                  paths_;
+    PathId                                   next_{0};   ///< Never handed out yet
+    std::vector<PathId>                      free_;
+    std::vector<Retiring>                    retiring_;
+    std::vector<Replaced>                    replaced_;
+    std::uint64_t                            overflow_{0};
+    std::shared_ptr<const CandidateSet>      current_;
+};
+
+// ----------------------------- Implementation ------------------------------
+
+template <class PathOf>
+std::shared_ptr<const CandidateSet>
+CandidateSet::compile(std::shared_ptr<const ServiceIndex> index, const MetricsTable& table, PathOf&& path_of) {
+    std::shared_ptr<CandidateSet> cs(new CandidateSet());
+    cs->index_    = std::move(index);
+    cs->services_ = cs->index_->size();
+    cs->ranges_.resize(cs->services_);
+
+    for (ServiceHandle h = 0; h < cs->services_; ++h) {
+        // Each service starts on a fresh line.
+        while (cs->path_ids_.size() % kRefsPerLine) cs->path_ids_.push_back(kInvalidPath);
+        const auto off = cs->path_ids_.size();
+        for (const Pop& p : cs->index_->pops(h)) {
+            if (p.health == Health::Down) continue;
+            const PathId id = path_of(p.id);
+            if (id == kInvalidPath || id >= table.size()) continue;
+            cs->path_ids_.push_back(id);
+        }
+        cs->ranges_[h] = Range{static_cast<std::uint32_t>(off),
+                               static_cast<std::uint32_t>(cs->path_ids_.size() - off)};
+    }
+    while (cs->path_ids_.size() % kRefsPerLine) cs->path_ids_.push_back(kInvalidPath);
+    cs->layout(table);
+    return cs;
+}
+
+} // namespace alpha::routing
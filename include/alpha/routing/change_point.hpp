@@ -0,0 +1,142 @@
+#pragma once
+/**
+ * @file change_point.hpp
+ * @brief Streaming change-point detection (CUSUM, Page-Hinkley) on per-path RTT and loss.
+ * @details Fixed thresholds (warn/degraded RTT) catch gross failures but not a 2 ms path
+ *          becoming a 3 ms path. The detectors here work on the relative deviation from a
+ *          reference level, z = (x - ref) / max(ref, floor), and accumulate it two-sided:
+ *            up = max(0, up + z - drift),  down = max(0, down - z - drift)
+ *          raising a ChangeEvent when either exceeds the threshold.
+ *            - Cusum: ref is a slow EWMA of the in-control level, frozen while a deviation
+ *              is accumulating (a sustained shift is not absorbed before it is reported).
+ *            - PageHinkley: ref is the mean since the last change, tracked with the
+ *              cumulative sums and their running minima (the classic m_t - M_t test).
+ *          After an event the detector re-baselines on the new level (warm-up again), so a
+ *          shift is reported once. State is a few floats per (path, metric): O(1) memory
+ *          and O(1) work per sample.
+ *
+ *          ChangeDetectorBank runs in the metrics aggregator, one sample per path per tick.
+ *          PathSubscribers maps the events to the services that use the changed paths, so
+ *          the control plane re-evaluates failover for just those, without waiting for the
+ *          periodic tick.
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "alpha/config/constants.hpp"
+#include "alpha/routing/service_index.hpp"
+
+namespace alpha::routing {
+
+/// Detection statistic.
+enum class ChangeMethod : std::uint8_t { Cusum, PageHinkley };
+
+/// Metric series watched per path.
+enum class PathMetric : std::uint8_t { Rtt = 0, Loss = 1 };
+
+/// Number of PathMetric values.
+inline constexpr std::size_t kPathMetricCount = 2;
+
+/// Detector parameters (relative units: 0.1 = 10% of the reference level).
+struct ChangeDetectorConfig final {
+    ChangeMethod  method{ChangeMethod::Cusum};
+    float         drift{alpha::config::constants::CHANGE_DRIFT};                   ///< Deviation absorbed per sample
+    float         threshold{alpha::config::constants::CHANGE_THRESHOLD};           ///< Accumulated deviation that fires
+    float         baseline_alpha{alpha::config::constants::CHANGE_BASELINE_ALPHA}; ///< Cusum reference EWMA weight
+    float         floor{0.0f};                                                     ///< Scale floor (metric units)
+    std::uint32_t warmup{alpha::config::constants::CHANGE_WARMUP_SAMPLES};         ///< Samples seeding the reference
+};
+
+/// Defaults for @p m (the scale floor differs: microseconds vs loss ratio).
+constexpr ChangeDetectorConfig default_change_config(PathMetric m) noexcept {
+    ChangeDetectorConfig c{};
+    c.floor = m == PathMetric::Rtt ? alpha::config::constants::CHANGE_RTT_FLOOR_US
+                                   : alpha::config::constants::CHANGE_LOSS_FLOOR;
+    return c;
+}
+
+/// A detected shift.
+struct ChangeEvent final {
+    std::uint32_t path{0};
+    PathMetric    metric{PathMetric::Rtt};
+    bool          increase{true};    ///< Level went up (degradation for RTT and loss)
+    float         before{0.0f};      ///< Reference level before the change
+    float         after{0.0f};       ///< Sample that fired
+};
+
+/**
+ * @class ChangeDetectorBank
+ * @brief One RTT and one loss detector per path (single writer: the metrics aggregator).
+ */
+class ChangeDetectorBank final {
+public:
+    explicit ChangeDetectorBank(std::size_t paths,
+                                ChangeDetectorConfig rtt  = default_change_config(PathMetric::Rtt),
+                                ChangeDetectorConfig loss = default_change_config(PathMetric::Loss));
+
+    /**
+     * @brief One sample per path (index = path); appends detected shifts to @p out.
+     * @return Number of events appended.
+     */
+    std::size_t update(std::span<const float> rtt_us, std::span<const float> loss, std::vector<ChangeEvent>& out);
+
+    /// @brief One sample for @p path. O(1).
+    std::size_t update(std::uint32_t path, float rtt_us, float loss, std::vector<ChangeEvent>& out);
+
+    /// @brief Current reference level of (@p path, @p m).
+    float reference(std::uint32_t path, PathMetric m) const noexcept { return at(path, m).ref; }
+
+    /// @brief Forget the history of @p path (e.g. the path was re-provisioned).
+    void reset(std::uint32_t path) noexcept;
+
+    std::size_t size() const noexcept { return state_.size() / kPathMetricCount; }
+
+private:
+    struct State {
+        float         ref{0.0f};
+        float         up{0.0f}, down{0.0f};          ///< Cusum sums / Page-Hinkley cumulative sums
+        float         up_min{0.0f}, down_min{0.0f};  ///< Page-Hinkley running minima
+        std::uint32_t n{0};                          ///< Samples since the last (re)baseline
+    };
+
+    State&       at(std::uint32_t path, PathMetric m) noexcept { return state_[path * kPathMetricCount + static_cast<std::size_t>(m)]; }
+    const State& at(std::uint32_t path, PathMetric m) const noexcept { return state_[path * kPathMetricCount + static_cast<std::size_t>(m)]; }
+
+    /// Feed one sample; true (and @p increase set) if it completes a change.
+    bool step(State& s, const ChangeDetectorConfig& c, float x, bool& increase) const noexcept;
+
+    std::array<ChangeDetectorConfig, kPathMetricCount> cfg_;
+    std::vector<State>                                 state_;   ///< [path][metric]
+};
+
+/**
+ * @class PathSubscribers
+ * @brief Path → services using it; turns change events into the set of services to re-evaluate.
+ */
+class PathSubscribers final {
+public:
+    explicit PathSubscribers(std::size_t paths) : by_path_(paths) {}
+
+    /// @brief Service @p h has @p path among its candidates.
+    void subscribe(std::uint32_t path, ServiceHandle h);
+
+    /// @brief Drop every subscription (before re-subscribing on a registry version change).
+    void clear() noexcept;
+
+    /**
+     * @brief Services using any path in @p events, each once, in event order.
+     * @return Number of handles appended to @p out.
+     */
+    std::size_t affected(std::span<const ChangeEvent> events, std::vector<ServiceHandle>& out);
+
+private:
+    std::vector<std::vector<ServiceHandle>> by_path_;
+    std::vector<std::uint32_t>              seen_;     ///< Per service: last pass that reported it
+    std::uint32_t                           pass_{0};
+};
+
+} // namespace alpha::routing
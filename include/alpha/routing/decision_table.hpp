@@ -0,0 +1,120 @@
+#pragma once
+/**
+ * @file decision_table.hpp
+ * @brief Lazy latency-aware decisions: best + backup path per (service, QoS class), per metrics epoch.
+ * @details Latency-aware inputs only change once per telemetry tick, so the answer is
+ *          computed once per MetricsTable epoch for every (service, class) pair into a
+ *          flat table. Packets do a single table read; they fall back to full
+ *          LatencyAwarePolicy evaluation only while the table is stale (not yet built
+ *          for their pinned epoch, or built against another CandidateSet).
+ *
+ *          Buffers follow the MetricsTable rotation (epoch % kBuffers), so they inherit
+ *          its reclamation: a buffer is rebuilt only after no worker can still be
+ *          pinned on the epoch it was built for.
+ *
+ * Per tick (control plane, or the first worker to see a new epoch):
+ *   table.build(candidates, metrics, metrics.epoch());
+ * Per packet (epoch pinned by the burst):
+ *   PathId p = table.choose(cs, h, cls, e, pkt);
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "alpha/routing/candidate_set.hpp"
+#include "alpha/routing/metrics_table.hpp"
+#include "alpha/routing/path_selection.hpp"
+
+namespace alpha::routing {
+
+/// Precomputed answer for one (service, class) pair.
+struct Decision final {
+    PathId best{kInvalidPath};    ///< Same result as LatencyAwarePolicy::choose() (no exploration)
+    PathId backup{kInvalidPath};  ///< Best healthy path other than `best`, if any
+};
+
+/**
+ * @class DecisionTable
+ * @brief Epoch-tagged flat [service][class] Decision arrays (one builder at a time, many readers).
+ */
+class DecisionTable final {
+public:
+    /// Tag of a buffer that was never built.
+    static constexpr std::uint64_t kNoEpoch = std::numeric_limits<std::uint64_t>::max();
+
+    /**
+     * @param cfg          Latency-aware settings (exploration is per packet and only
+     *                     applies on the fallback path).
+     * @param class_dscp   Representative DSCP per QoS class (e.g. QoSTables::dscp_by_class);
+     *                     its size is the class count.
+     * @param max_services Services covered; larger handles always take the fallback.
+     */
+    DecisionTable(LatencyAwareConfig cfg, std::span<const std::uint8_t> class_dscp, std::size_t max_services);
+
+    DecisionTable(const DecisionTable&)            = delete;
+    DecisionTable& operator=(const DecisionTable&) = delete;
+
+    /**
+     * @brief Compute all decisions of @p cs against metrics epoch @p epoch.
+     * @note The builder must stay pinned on @p epoch (MetricsTable::enter) while it runs,
+     *       which keeps the target buffer out of reuse. Concurrent callers are fine: the
+     *       first to claim an epoch builds it, the others return false.
+     *       A CandidateSet published mid-epoch takes the fallback until the next epoch.
+     * @return true if this call built the table.
+     */
+    bool build(const CandidateSet& cs, const MetricsTable& metrics, std::uint64_t epoch) noexcept;
+
+    /**
+     * @brief Decision for (@p h, @p cls) if the table is current for @p epoch and @p cs.
+     * @return nullptr when stale (caller evaluates in full).
+     */
+    const Decision* lookup(const CandidateSet& cs, ServiceHandle h, std::size_t cls,
+                           std::uint64_t epoch) const noexcept {
+        const Buffer& b = bufs_[epoch % MetricsTable::kBuffers];
+        if (b.epoch.load(std::memory_order_acquire) != epoch || b.version != cs.version()) return nullptr;
+        if (h >= b.services || cls >= classes_) return nullptr;
+        return &b.d[h * classes_ + cls];
+    }
+
+    /**
+     * @brief Lazy decision: one table read, full evaluation only when stale.
+     * @param epoch Epoch pinned with MetricsTable::enter() for this burst.
+     */
+    PathId choose(const CandidateSet& cs, ServiceHandle h, std::size_t cls,
+                  std::uint64_t epoch, const PacketContext& pkt) noexcept {
+        if (const Decision* d = lookup(cs, h, cls, epoch); d && d->best != kInvalidPath) return d->best;
+        return policy_.choose(cs.candidates(h, epoch), pkt);
+    }
+
+    /// @brief Number of QoS classes.
+    std::size_t classes() const noexcept { return classes_; }
+
+    /// @brief Newest epoch a build was claimed for (kNoEpoch if none yet).
+    std::uint64_t built_epoch() const noexcept {
+        const auto c = claimed_.load(std::memory_order_acquire);
+        return c == 0 ? kNoEpoch : c - 1;
+    }
+
+private:
+    struct alignas(ALPHA_CACHELINE) Buffer {
+        std::atomic<std::uint64_t> epoch{kNoEpoch};  ///< Published last (release)
+        std::uint64_t              version{0};       ///< CandidateSet version it was built from
+        std::size_t                services{0};
+        std::unique_ptr<Decision[]> d;               ///< [max_services][classes]
+    };
+
+    LatencyAwareConfig                  cfg_;
+    LatencyAwarePolicy                  policy_;     ///< Fallback evaluation
+    std::size_t                         classes_{0};
+    std::size_t                         max_services_{0};
+    std::vector<std::uint8_t>           class_dscp_;
+    Buffer                              bufs_[MetricsTable::kBuffers];
+    alignas(ALPHA_CACHELINE) std::atomic<std::uint64_t> claimed_{0};  ///< Last claimed epoch + 1
+};
+
+} // namespace alpha::routing
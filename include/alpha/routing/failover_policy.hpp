@@ -10,6 +10,7 @@
 #include <optional>
 #include <chrono>
 #include <cstdint>
+#include "alpha/routing/pop.hpp"
 #include "alpha/routing/qos_policy.hpp"
 #include "alpha/config/constants.hpp"
 
@@ -29,6 +30,9 @@ struct FailoverConfig {
     double      improve_pct_to_switch{alpha::config::constants::FAILOVER_IMPROVE_PCT_TO_SWITCH}; ///< Required relative improvement
     uint32_t    min_hold_ms{alpha::config::constants::FAILOVER_MIN_HOLD_MS};   ///< Dwell time before switching
     uint32_t    recovery_hold_ms{alpha::config::constants::FAILOVER_RECOVERY_HOLD_MS}; ///< Primary recovery dwell
+    bool        prefer_srlg_disjoint{alpha::config::constants::FAILOVER_PREFER_SRLG_DISJOINT}; ///< Backup avoids current's risk groups
+    uint32_t    return_step_ppm{alpha::config::constants::FAILOVER_RETURN_STEP_PPM}; ///< Ramp return-to-primary in steps (0: at once)
+    bool        preempt_on_forecast{alpha::config::constants::FAILOVER_PREEMPT_ON_FORECAST}; ///< Act on predicted scores
 };
 
 /** @struct PathHealth
@@ -38,6 +42,7 @@ struct PathHealth {
     std::string path_id; ///< Path identifier
     HealthState state{HealthState::Up}; ///< Current health state
     std::chrono::steady_clock::time_point last_change{}; ///< Last state change (steady clock)
+    SrlgMask    srlg{0}; ///< Shared-risk groups the path traverses (see srlg.hpp)
 };
 
 /** @struct FailoverDecision
@@ -46,6 +51,7 @@ struct PathHealth {
 struct FailoverDecision {
     std::string next_path_id; ///< Path to switch to
     std::string reason;       ///< Human/observability reason string
+    uint32_t    step_ppm{0};  ///< Non-zero: shift traffic gradually in steps of this share (traffic_shift.hpp)
 };
 
 /** @class FailoverPolicy
@@ -61,7 +67,7 @@ public:
      * @param current_path_id Current active path identifier.
      * @param scored_candidates Vector of QoS scores for candidate paths.
      * @param health Vector of health states corresponding to paths.
-     * @param now Monotonic time for hysteresis checks.
+     * @param now Monotonic time for hysteresis checks (on workers: os::BurstClock::now()).
      * @return A decision if a switch is recommended; std::nullopt to keep current.
      */
     std::optional<FailoverDecision>
@@ -70,6 +76,22 @@ public:
              const std::vector<PathHealth>& health,
              std::chrono::steady_clock::time_point now) const;
 
+    /**
+     * @brief As above, then pre-empt: leave a path predicted to breach its targets.
+     * @param predicted Scores of the same candidates over the next hold period
+     *        (QoSPolicy::score_path with a MetricForecaster, horizon from min_hold_ms).
+     * @details If the regular evaluation keeps the current path, but its predicted score
+     *          is outside the thresholds, it switches ("predicted_degradation") to the best
+     *          predicted-compliant, non-Down candidate if that one is predicted better,
+     *          subject to min_hold_ms.
+     */
+    std::optional<FailoverDecision>
+    evaluate(const std::string& current_path_id,
+             const std::vector<QoSScore>& scored_candidates,
+             const std::vector<QoSScore>& predicted,
+             const std::vector<PathHealth>& health,
+             std::chrono::steady_clock::time_point now) const;
+
     /// @return Current configuration (by const reference).
     const FailoverConfig& config() const noexcept { return cfg_; }
 
@@ -80,6 +102,9 @@ private:
     /// Lookup a path's HealthState.
     static HealthState state_of(const std::string& id, const std::vector<PathHealth>& h);
 
+    /// Lookup a path's shared-risk groups (0 if unknown).
+    static SrlgMask srlg_of(const std::string& id, const std::vector<PathHealth>& h);
+
     /// Check dwell/hold timers to allow switching.
     bool allow_switch(std::chrono::steady_clock::time_point current_last_change,
                       std::chrono::steady_clock::time_point now,
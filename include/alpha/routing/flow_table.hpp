@@ -0,0 +1,171 @@
+#pragma once
+/**
+ * @file flow_table.hpp
+ * @brief Per-worker flow table pinning flows to paths (open addressing, fixed capacity).
+ * @details Single-writer: each data-plane worker owns its table. Storage is
+ *          allocated once at construction; insert/find/erase never allocate.
+ *          Optional per-path active-flow counters (track_paths()) are kept exact on
+ *          every insert, re-pin and erase, so load-aware policies read them for free.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include "alpha/routing/path_selection.hpp"
+
+namespace alpha::routing {
+
+/**
+ * @struct FlowEntry
+ * @brief One pinned flow. Trivially copyable so it can be handed between workers.
+ */
+struct FlowEntry final {
+    std::uint64_t key{0};  ///< Flow fingerprint (0 = empty slot)
+    std::uint32_t hash{0}; ///< 32-bit flow hash (PacketContext::flow_hash, RSS bucket source)
+    PathId        path{0}; ///< Pinned path
+};
+
+/**
+ * @class FlowTable
+ * @brief Linear-probing hash table keyed by a 64-bit flow fingerprint.
+ *
+ * Design:
+ *  - Capacity is a power-of-two fixed at construction; usable size is capped at
+ *    3/4 of capacity to keep probe sequences short.
+ *  - Deletion uses backward-shift (no tombstones), so lookups never degrade.
+ *  - Key 0 is reserved as the empty marker; inserts with key 0 are rejected.
+ *  - Slots may live in caller storage (e.g. a shared-memory handoff region) so a
+ *    restarted process can adopt the pins in place.
+ */
+class FlowTable final {
+public:
+    /// @brief Construct a table with @p capacity_pow2 slots (aborts if not a power-of-two).
+    explicit FlowTable(std::size_t capacity_pow2);
+
+    /**
+     * @brief Construct over caller-owned @p storage (not freed by the table).
+     * @param storage Slot array; size must be a power-of-two (aborts otherwise).
+     * @param adopt Keep the entries already in @p storage (restart) instead of clearing.
+     *              Aborts if the region fails can_adopt(): past the load cap, probes
+     *              could find no empty slot and never terminate.
+     */
+    FlowTable(std::span<FlowEntry> storage, bool adopt);
+
+    /**
+     * @brief True if @p storage can be adopted: power-of-two size and at most 3/4 occupied.
+     * @note Check a region received at handoff before adopting it; a corrupt or foreign
+     *       region can then be rebuilt fresh (adopt = false) instead of aborting.
+     */
+    static bool can_adopt(std::span<const FlowEntry> storage) noexcept;
+
+    FlowTable(const FlowTable&)            = delete;
+    FlowTable& operator=(const FlowTable&) = delete;
+    FlowTable(FlowTable&&) noexcept            = default;
+    FlowTable& operator=(FlowTable&&) noexcept = default;
+
+    /// @brief Keys hashed and prefetched together by find_burst().
+    static constexpr std::size_t kPrefetchGroup = 16;
+
+    /// @brief Find the entry for @p key, or nullptr if absent.
+    const FlowEntry* find(std::uint64_t key) const noexcept;
+
+    /**
+     * @brief Look up a burst of keys with overlapped cache misses (group prefetching).
+     *
+     * Each group of kPrefetchGroup keys is hashed and every home slot prefetched
+     * before any comparison, so DRAM misses overlap instead of serializing.
+     * @param keys Keys to look up.
+     * @param out  One result per key (nullptr if absent); must be >= keys.size().
+     */
+    void find_burst(std::span<const std::uint64_t> keys,
+                    std::span<const FlowEntry*> out) const noexcept;
+
+    /**
+     * @brief Insert a flow or re-pin an existing one.
+     * @return false if @p key is 0 or the table is at its load limit.
+     */
+    bool insert(std::uint64_t key, std::uint32_t hash, PathId path) noexcept;
+
+    /// @brief Remove a flow. Returns true if it was present.
+    bool erase(std::uint64_t key) noexcept;
+
+    /**
+     * @brief Maintain active-flow counters for paths [0, @p paths) (allocates; bring-up only).
+     * @note Counts the entries already present (e.g. adopted pins). Flows on paths
+     *       >= @p paths are not counted.
+     */
+    void track_paths(std::size_t paths);
+
+    /// @brief Flows currently pinned to @p path (0 if untracked).
+    std::uint32_t active_flows(PathId path) const noexcept {
+        return path < tracked_paths_ ? path_flows_[path] : 0u;
+    }
+
+    /// @brief Active-flow counter per tracked path (indexed by PathId).
+    std::span<const std::uint32_t> path_flows() const noexcept {
+        return {path_flows_.get(), tracked_paths_};
+    }
+
+    /// @brief Visit every live entry (unspecified order).
+    template <class Fn>
+    void for_each(Fn&& fn) const {
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            if (slots_[i].key != 0) fn(slots_[i]);
+        }
+    }
+
+    /// @brief Erase every entry matching @p pred. Returns the number erased.
+    template <class Pred>
+    std::size_t erase_if(Pred&& pred) noexcept {
+        if (size_ == 0) return 0;
+        // Start right after an empty slot so backward shifts never wrap into
+        // slots we have already visited.
+        std::size_t start = 0;
+        while (slots_[start].key != 0) start = (start + 1) & mask_;
+        std::size_t erased = 0;
+        for (std::size_t n = 0; n < capacity_; ++n) {
+            const std::size_t i = (start + 1 + n) & mask_;
+            // A shifted-in entry lands on i, so re-test the same slot.
+            while (slots_[i].key != 0 && pred(static_cast<const FlowEntry&>(slots_[i]))) {
+                remove_at(i);
+                ++erased;
+            }
+        }
+        return erased;
+    }
+
+    /// @brief Number of live entries.
+    std::size_t size() const noexcept { return size_; }
+
+    /// @brief Slot count (power-of-two).
+    std::size_t capacity() const noexcept { return capacity_; }
+
+    /// @brief Maximum number of live entries accepted (load-factor cap).
+    std::size_t max_size() const noexcept { return capacity_ - capacity_ / 4; }
+
+private:
+    /// Home slot for a key (Fibonacci hashing over a 64-bit mix).
+    std::size_t home_of(std::uint64_t key) const noexcept;
+
+    /// Backward-shift delete of the entry at slot @p i.
+    void remove_at(std::size_t i) noexcept;
+
+    /// Validate capacity and derive mask/shift (aborts on invalid sizing).
+    void init_geometry(std::size_t capacity_pow2);
+
+    void count_in(PathId path) noexcept  { if (path < tracked_paths_) ++path_flows_[path]; }
+    void count_out(PathId path) noexcept { if (path < tracked_paths_) --path_flows_[path]; }
+
+    std::size_t                      capacity_{0};
+    std::size_t                      mask_{0};
+    std::size_t                      size_{0};
+    unsigned                         shift_{0};   ///< 64 - log2(capacity)
+    FlowEntry*                       slots_{nullptr}; ///< Owned (owned_) or external storage
+    std::unique_ptr<FlowEntry[]>     owned_{};
+    std::size_t                      tracked_paths_{0};
+    std::unique_ptr<std::uint32_t[]> path_flows_{}; ///< Active flows per PathId (track_paths())
+};
+
+} // namespace alpha::routing
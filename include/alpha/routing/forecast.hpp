@@ -0,0 +1,87 @@
+#pragma once
+/**
+ * @file forecast.hpp
+ * @brief Per-path RTT/loss forecasting (damped Holt linear trend) for pre-emptive failover.
+ * @details Each path keeps a level and a trend per metric: four floats, updated in O(1)
+ *          per sample and never resized. State is laid out per metric across paths
+ *          (structure of arrays), so the per-tick update and predict loops over all paths
+ *          are straight-line float arithmetic the compiler vectorizes.
+ *
+ *          Damped Holt, one sample x per tick:
+ *            level' = a·x + (1 - a)·(level + φ·trend)
+ *            trend' = b·(level' - level) + (1 - b)·φ·trend
+ *            x̂(h)   = level + (φ + φ² + ... + φʰ)·trend
+ *          The damping (φ < 1) keeps a short burst from being extrapolated without bound.
+ *          Inputs are the aggregator's already EWMA'd series, so the defaults smooth lightly.
+ *
+ *          QoSPolicy::score_path() can score the forecast over a hold period, and
+ *          FailoverPolicy::evaluate() takes those predicted scores to leave a path
+ *          before its SLO is breached.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "alpha/config/constants.hpp"
+
+namespace alpha::routing {
+
+/// Smoothing constants and tick length.
+struct ForecastConfig final {
+    float         alpha{alpha::config::constants::FORECAST_ALPHA};      ///< Level smoothing (0, 1]
+    float         beta{alpha::config::constants::FORECAST_BETA};        ///< Trend smoothing (0, 1]
+    float         phi{alpha::config::constants::FORECAST_DAMPING};      ///< Trend damping (0, 1]; 1 = plain Holt
+    std::uint32_t tick_ms{alpha::config::constants::FORECAST_TICK_MS};  ///< Sample interval (horizon conversion)
+};
+
+/**
+ * @class MetricForecaster
+ * @brief Fixed-size damped-trend state for RTT and loss of every path (control plane, single writer).
+ */
+class MetricForecaster final {
+public:
+    /// @brief @p paths series pairs (e.g. MetricsTable::size()), no samples yet.
+    explicit MetricForecaster(std::size_t paths, ForecastConfig cfg = {});
+
+    /**
+     * @brief One sample per path (the aggregator's tick); vectorized across paths.
+     * @param rtt_us RTT per path; @p loss Loss ratio [0, 1] per path. Extra entries are ignored.
+     */
+    void update(std::span<const float> rtt_us, std::span<const float> loss) noexcept;
+
+    /// @brief One sample for @p path. O(1).
+    void update(std::size_t path, float rtt_us, float loss) noexcept;
+
+    /// @brief Forecast RTT @p horizon ticks ahead (never negative; 0 before the first sample).
+    float rtt_us(std::size_t path, std::uint32_t horizon) const noexcept;
+
+    /// @brief Forecast loss @p horizon ticks ahead, clamped to [0, 1].
+    float loss(std::size_t path, std::uint32_t horizon) const noexcept;
+
+    /// @brief Forecast every path @p horizon ticks ahead into @p rtt_out / @p loss_out (vectorized).
+    void predict(std::uint32_t horizon, std::span<float> rtt_out, std::span<float> loss_out) const noexcept;
+
+    /// @brief RTT trend per tick (positive: deteriorating).
+    float rtt_trend(std::size_t path) const noexcept { return rtt_trend_[path]; }
+
+    /// @brief Ticks covering @p ms (rounded up), e.g. FailoverConfig::min_hold_ms.
+    std::uint32_t horizon(std::uint32_t ms) const noexcept {
+        return cfg_.tick_ms ? (ms + cfg_.tick_ms - 1) / cfg_.tick_ms : 0;
+    }
+
+    std::size_t           size() const noexcept { return rtt_level_.size(); }
+    const ForecastConfig& config() const noexcept { return cfg_; }
+
+private:
+    /// φ + φ² + ... + φʰ.
+    float damped(std::uint32_t horizon) const noexcept;
+
+    ForecastConfig     cfg_;
+    std::vector<float> rtt_level_, rtt_trend_;
+    std::vector<float> loss_level_, loss_trend_;
+    std::vector<float> seen_;   ///< 0 until the first sample (which seeds the level), then 1
+};
+
+} // namespace alpha::routing
@@ -0,0 +1,128 @@
+#pragma once
+/**
+ * @file metrics_table.hpp
+ * @brief Tick-consistent metrics for all paths, published once per telemetry tick.
+ * @details A few preallocated, contiguous MetricsSlot buffers; the control plane fills
+ *          the next one (copy-forward + bulk updates) and publishes it with a single
+ *          release store of the epoch. Workers pin an epoch per burst, so every decision
+ *          in the burst sees the same tick. A buffer is reused only after every worker
+ *          has moved past it (quiescent-state reclamation, no allocation after setup).
+ *
+ * Data plane, per burst:
+ *   const auto e = table.enter(worker);       // pin
+ *   const MetricsSlot* m = table.slots(e);    // CandidateRef::slot points in here
+ *   ...decide...
+ *   table.leave(worker);                      // optional: only when going idle
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+
+#include "alpha/routing/path_selection.hpp"
+
+namespace alpha::routing {
+
+/// One path's new metrics for a tick.
+struct PathUpdate final {
+    PathId      id{0};
+    PathMetrics metrics{};
+};
+
+/**
+ * @class MetricsTable
+ * @brief Epoch-versioned arena of MetricsSlot (single writer, fixed reader count).
+ *
+ * Slots in a published buffer are never written again until reclaimed, so their
+ * seqlock is always even and dp::load_metrics() succeeds on the first attempt.
+ */
+class MetricsTable final {
+public:
+    /// Buffers in rotation: a pinned reader may fall two ticks behind before publish() stalls.
+    static constexpr std::size_t kBuffers = 3;
+
+    /// Epoch a reader announces when it holds no buffer.
+    static constexpr std::uint64_t kOffline = std::numeric_limits<std::uint64_t>::max();
+
+    /**
+     * @brief Allocate @p paths slots per buffer for @p readers worker threads.
+     * @note Pages are first touched here: construct on the workers' NUMA node.
+     */
+    MetricsTable(std::size_t paths, std::size_t readers);
+
+    MetricsTable(const MetricsTable&)            = delete;
+    MetricsTable& operator=(const MetricsTable&) = delete;
+
+    // ---------------------------- Control plane ----------------------------
+
+    /**
+     * @brief Publish a tick: copy the current buffer forward, apply @p updates, and
+     *        make it visible with one release store.
+     * @return false if a lagging reader still pins the target buffer (nothing is
+     *         published; retry next tick with the accumulated updates). Updates with
+     *         out-of-range ids are ignored.
+     */
+    bool publish(std::span<const PathUpdate> updates) noexcept;
+
+    // ---------------------------- Data plane -------------------------------
+
+    /**
+     * @brief Pin the newest epoch for @p reader (one per worker thread).
+     * @return Epoch to pass to slots(); valid until the next enter()/leave() by this reader.
+     */
+    std::uint64_t enter(std::size_t reader) noexcept {
+        auto& a = announce_[reader].v;
+        std::uint64_t e = epoch_.load(std::memory_order_acquire);
+        for (;;) {
+            a.store(e, std::memory_order_seq_cst);
+            // Re-check: either we see a newer tick, or the writer sees our announcement.
+            const std::uint64_t again = epoch_.load(std::memory_order_seq_cst);
+            if (again == e) return e;
+            e = again;
+        }
+    }
+
+    /// @brief Release the pinned epoch (reader going idle).
+    void leave(std::size_t reader) noexcept {
+        announce_[reader].v.store(kOffline, std::memory_order_release);
+    }
+
+    /// @brief Slot array for a pinned epoch (indexed by PathId).
+    const MetricsSlot* slots(std::uint64_t epoch) const noexcept {
+        return buf_.get() + (epoch % kBuffers) * paths_;
+    }
+
+    // ---------------------------- Observers --------------------------------
+
+    /// @brief Newest published epoch (starts at 0: all paths default/unhealthy).
+    std::uint64_t epoch() const noexcept { return epoch_.load(std::memory_order_acquire); }
+
+    /// @brief Paths per buffer.
+    std::size_t size() const noexcept { return paths_; }
+
+    /// @brief Registered reader count.
+    std::size_t readers() const noexcept { return readers_; }
+
+    /// @brief Ticks refused because a reader lagged (publish() returned false).
+    std::uint64_t stalled_ticks() const noexcept { return stalled_; }
+
+private:
+    struct alignas(ALPHA_CACHELINE) Announce {
+        std::atomic<std::uint64_t> v{kOffline};
+    };
+
+    /// True if no reader can still be on buffer (epoch % kBuffers).
+    bool reclaimable(std::uint64_t epoch) const noexcept;
+
+    alignas(ALPHA_CACHELINE) std::atomic<std::uint64_t> epoch_{0};
+    std::size_t                  paths_{0};
+    std::size_t                  readers_{0};
+    std::uint64_t                stalled_{0};
+    std::unique_ptr<MetricsSlot[]> buf_;       ///< kBuffers * paths_ contiguous slots
+    std::unique_ptr<Announce[]>    announce_;  ///< One line per reader
+};
+
+} // namespace alpha::routing
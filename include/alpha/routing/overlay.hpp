@@ -0,0 +1,185 @@
+#pragma once
+/**
+ * @file overlay.hpp
+ * @brief Overlay relay routes: best one- and two-relay paths between PoPs from a probed latency/loss matrix.
+ * @details The prober fills an all-pairs OverlayMatrix (dense PoP indices, one row per
+ *          source PoP). Once per telemetry tick the control plane recomputes, per QoS
+ *          class, the cheapest ingress → relay → destination and ingress → relay →
+ *          relay → destination routes with two min-plus products over the class cost
+ *          matrix (leg cost = RTT + loss penalty). Routes are simple paths: no PoP
+ *          appears twice. The inner loop is a branch-free
+ *          add/compare/select over a contiguous row, which the compiler vectorizes;
+ *          500 PoPs recompute well within a 500 ms probe interval (see overlay_bench).
+ *
+ *          The result is an immutable OverlayTable swapped in by OverlayRouter (RCU via
+ *          shared_ptr). Relay routes reach the path policies as extra candidates: the
+ *          caller reserves one PathId per (destination, relay count) in its MetricsTable
+ *          and relay_updates() fills them each tick, healthy only while the route beats
+ *          the direct path.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "alpha/routing/metrics_table.hpp"
+#include "alpha/routing/path_selection.hpp"
+
+namespace alpha::routing {
+
+/// Dense PoP index within an overlay matrix.
+using PopIndex = std::uint16_t;
+
+/// No relay (route absent).
+inline constexpr PopIndex kNoRelay = 0xFFFF;
+
+/// Largest overlay (PoP indices must stay below kNoRelay).
+inline constexpr std::size_t kOverlayMaxPops = kNoRelay;
+
+/// Per-class leg cost: rtt_us + loss_ppm * loss_penalty_us / 1e6, plus relay_penalty_us per relay.
+struct OverlayClass final {
+    std::uint32_t loss_penalty_us{0};     ///< Cost of 100% loss on a leg
+    std::uint32_t relay_penalty_us{0};    ///< Forwarding cost charged per relay PoP
+};
+
+/// Class cost of one leg (before the relay penalty).
+inline std::uint64_t overlay_leg_cost(std::uint32_t rtt_us, std::uint32_t loss_ppm, const OverlayClass& c) noexcept {
+    return std::uint64_t{rtt_us} + std::uint64_t{loss_ppm} * c.loss_penalty_us / 1'000'000;
+}
+
+/// A route from the table, with composed metrics.
+struct OverlayRoute final {
+    std::uint8_t  relays{0};                        ///< 0 = direct
+    PopIndex      via[2]{kNoRelay, kNoRelay};
+    std::uint32_t rtt_us{0};                        ///< Sum of leg RTTs
+    std::uint32_t loss_ppm{0};                      ///< 1 - prod(1 - leg loss)
+    std::uint32_t cost_us{0};                       ///< Class cost (ranking)
+    bool          valid{false};                     ///< Every leg is up
+};
+
+/**
+ * @class OverlayMatrix
+ * @brief All-pairs probe results (row = source PoP); written by the prober thread.
+ * @details Plain arrays, no synchronization: OverlayTable::compute() and
+ *          OverlayRouter::recompute() read the matrix while they run. Hand them a
+ *          matrix the prober is not writing to, e.g. a copy taken at the tick
+ *          boundary (the class is copyable).
+ */
+class OverlayMatrix final {
+public:
+    /// RTT marking a leg down.
+    static constexpr std::uint32_t kDown = 0xFFFFFFFFu;
+
+    /// @brief @p pops PoPs (at most kOverlayMaxPops), every leg down.
+    explicit OverlayMatrix(std::size_t pops);
+
+    /// @brief Record a probe result for the leg @p from → @p to.
+    void set(PopIndex from, PopIndex to, std::uint32_t rtt_us, std::uint32_t loss_ppm) noexcept {
+        rtt_[at(from, to)]  = rtt_us;
+        loss_[at(from, to)] = loss_ppm;
+    }
+
+    /// @brief Mark the leg @p from → @p to unreachable.
+    void set_down(PopIndex from, PopIndex to) noexcept { set(from, to, kDown, 1'000'000); }
+
+    std::uint32_t rtt_us(PopIndex from, PopIndex to) const noexcept { return rtt_[at(from, to)]; }
+    std::uint32_t loss_ppm(PopIndex from, PopIndex to) const noexcept { return loss_[at(from, to)]; }
+    bool up(PopIndex from, PopIndex to) const noexcept { return from != to && rtt_[at(from, to)] != kDown; }
+
+    std::size_t size() const noexcept { return n_; }
+
+private:
+    std::size_t at(PopIndex from, PopIndex to) const noexcept { return std::size_t{from} * n_ + to; }
+
+    std::size_t                n_;
+    std::vector<std::uint32_t> rtt_;
+    std::vector<std::uint32_t> loss_;
+};
+
+/**
+ * @class OverlayTable
+ * @brief Best relay routes per (class, ingress, destination); immutable, any number of readers.
+ */
+class OverlayTable final {
+public:
+    /// @brief Compute relay routes for every class from @p m (must not change while this runs).
+    static std::shared_ptr<const OverlayTable> compute(const OverlayMatrix& m, std::span<const OverlayClass> classes);
+
+    /// @brief Direct leg @p from → @p to under class @p cls.
+    OverlayRoute direct(PopIndex from, PopIndex to, std::uint8_t cls) const noexcept;
+
+    /// @brief Cheapest route through exactly @p relays (1 or 2) relay PoPs; invalid if none.
+    OverlayRoute relay(PopIndex from, PopIndex to, std::uint8_t cls, std::uint8_t relays) const noexcept;
+
+    /// @brief Cheapest of direct, one-relay and two-relay routes.
+    OverlayRoute best(PopIndex from, PopIndex to, std::uint8_t cls) const noexcept;
+
+    /**
+     * @brief Metrics for the relay candidates of @p ingress, one update per reserved PathId.
+     * @param one_relay PathId per destination PoP for its one-relay candidate (empty: none).
+     * @param two_relay PathId per destination PoP for its two-relay candidate (empty: none).
+     * @note A candidate is healthy only while its route is cheaper than the direct leg.
+     */
+    void relay_updates(PopIndex ingress, std::uint8_t cls,
+                       std::span<const PathId> one_relay, std::span<const PathId> two_relay,
+                       std::vector<PathUpdate>& out) const;
+
+    std::size_t   pops() const noexcept { return n_; }
+    std::size_t   classes() const noexcept { return classes_.size(); }
+    std::uint64_t generation() const noexcept { return generation_; }
+
+private:
+    friend class OverlayRouter;
+
+    /// Relays chosen for one (class, ingress, destination).
+    struct Relays {
+        PopIndex one{kNoRelay};
+        PopIndex two[2]{kNoRelay, kNoRelay};
+    };
+
+    OverlayTable() = default;
+
+    static std::shared_ptr<OverlayTable> build(const OverlayMatrix& m, std::span<const OverlayClass> classes,
+                                               std::uint64_t generation);
+
+    std::size_t at(std::uint8_t cls, PopIndex from, PopIndex to) const noexcept {
+        return (std::size_t{cls} * n_ + from) * n_ + to;
+    }
+
+    /// Compose the legs @p hops[0] → ... → @p hops[count - 1].
+    OverlayRoute compose(const PopIndex* hops, std::size_t count, std::uint8_t cls) const noexcept;
+
+    std::size_t                n_{0};
+    std::vector<OverlayClass>  classes_;
+    std::vector<std::uint32_t> rtt_;       ///< Matrix snapshot the routes were computed from
+    std::vector<std::uint32_t> loss_;
+    std::vector<Relays>        relays_;    ///< [class][from][to]
+    std::uint64_t              generation_{0};
+};
+
+/**
+ * @class OverlayRouter
+ * @brief Control-plane owner of the class set and the published OverlayTable.
+ */
+class OverlayRouter final {
+public:
+    explicit OverlayRouter(std::vector<OverlayClass> classes);
+
+    /// @brief Recompute from @p m and publish (once per telemetry tick; @p m quiescent meanwhile).
+    std::shared_ptr<const OverlayTable> recompute(const OverlayMatrix& m);
+
+    /// @brief Current table (RCU pin; any thread). Never null.
+    std::shared_ptr<const OverlayTable> current() const noexcept {
+        return std::atomic_load_explicit(&current_, std::memory_order_acquire);
+    }
+
+private:
+    std::vector<OverlayClass>           classes_;
+    std::uint64_t                       generation_{0};
+    std::shared_ptr<const OverlayTable> current_;
+};
+
+} // namespace alpha::routing
@@ -6,6 +6,7 @@
  * @brief Routing path selection interfaces and data structures (lock-free snapshots).
  * @note Readers use acquire+recheck; writers publish with release (seqlock pattern).
  */
+#include <cstddef>
 #include <cstdint>
 #include <atomic>
 #include <span>
@@ -35,6 +36,16 @@ struct alignas(ALPHA_CACHELINE) MetricsSlot final {
     PathMetrics                metrics{};
 };
 
+/// Left-right (double-buffered) slot: readers never retry and never fail.
+/// Writer fills the copy readers are not on, flips, waits for stragglers on the
+/// old read-indicator, then refreshes the other copy. Reads are wait-free (two RMWs).
+struct alignas(ALPHA_CACHELINE) LrMetricsSlot final {
+    std::atomic<std::uint32_t>         left_right{0};  // copy readers use
+    std::atomic<std::uint32_t>         version{0};     // read-indicator readers register on
+    mutable std::atomic<std::uint32_t> readers[2]{};   // per-indicator in-flight readers
+    PathMetrics                        copy[2]{};
+};
+
 /// Reference to a candidate path (id + pointer to metrics slot).
 struct CandidateRef final {
     PathId             id{0};
@@ -50,16 +61,30 @@ struct PacketContext final {
 namespace cp {
 // Control-plane: publish new metrics into a slot (single writer per slot).
 void update_metrics(MetricsSlot& s, const PathMetrics& m) noexcept;
+// Control-plane: left-right publish; may briefly wait for in-flight readers.
+void update_metrics(LrMetricsSlot& s, const PathMetrics& m) noexcept;
 }
 
 namespace dp {
 // Data-plane: lock-free snapshot read of a slot. Returns false on rare retry fail.
 bool load_metrics(const MetricsSlot& s, PathMetrics& out) noexcept;
+// Data-plane: wait-free read of a left-right slot. Always succeeds on the first attempt.
+void load_metrics(const LrMetricsSlot& s, PathMetrics& out) noexcept;
 }
 
 // Internal QoS helper (definition in .cpp)
 bool qos_match(std::uint8_t path_class, std::uint8_t dscp) noexcept;
 
+/// Map a 32-bit hash onto [0, n) with one multiply and shift (no division).
+/// Uses the high bits of @p h, so it stays independent of the low-bit RSS bucket.
+inline constexpr std::uint32_t fast_range32(std::uint32_t h, std::uint32_t n) noexcept {
+    return static_cast<std::uint32_t>((static_cast<std::uint64_t>(h) * n) >> 32);
+}
+
+/// Candidate counts with a compile-time specialized choose_n<N>() (see policy_binding.hpp).
+inline constexpr std::size_t kMinFixedCandidates = 2;
+inline constexpr std::size_t kMaxFixedCandidates = 4;
+
 // ---------------- Policies (declarations) ----------------
 
 class RoundRobinPolicy final {
@@ -76,6 +101,10 @@ public:
     explicit FlowHashPolicy(bool skip_unhealthy = true) noexcept;
     PathId choose(std::span<const CandidateRef> cands,
                   const PacketContext& pkt) noexcept;
+    /// Fixed-count variant (N = 2..4, instantiated in the .cpp): unrolled, same result as choose().
+    template <std::size_t N>
+    PathId choose_n(std::span<const CandidateRef, N> cands,
+                    const PacketContext& pkt) noexcept;
 private:
     bool skip_unhealthy_;
 };
@@ -91,6 +120,11 @@ public:
     explicit LatencyAwarePolicy(LatencyAwareConfig cfg = {}) noexcept;
     PathId choose(std::span<const CandidateRef> cands,
                   const PacketContext& pkt) noexcept;
+    /// Fixed-count variant (N = 2..4): unrolled select-based argmin, same result as choose().
+    /// Exploration (explore_ppm != 0) is delegated to choose().
+    template <std::size_t N>
+    PathId choose_n(std::span<const CandidateRef, N> cands,
+                    const PacketContext& pkt) noexcept;
 private:
     LatencyAwareConfig cfg_{};
     std::atomic<std::uint32_t> salt_{0xA5A55A5Au};
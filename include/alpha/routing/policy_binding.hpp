@@ -7,7 +7,9 @@
  * @note Writers publish (release) an even seq; readers retry on odd/changed seq (seqlock).
  */
 #include <atomic>
+#include <concepts>
 #include <span>
+#include <cstddef>
 #include <cstdint>
 #include "alpha/routing/path_selection.hpp"
 
@@ -29,6 +31,37 @@ namespace detail {
                                const PacketContext& pkt) noexcept {
         return static_cast<Policy*>(state)->choose(cands, pkt);
     }
+
+    /// Policies that provide choose_n<N>() for fixed candidate counts.
+    template <typename Policy>
+    concept FixedCountPolicy = requires(Policy& p, std::span<const CandidateRef, 2> c, const PacketContext& k) {
+        { p.template choose_n<2>(c, k) } -> std::same_as<PathId>;
+    };
+
+    template <typename Policy, std::size_t N>
+    inline PathId choose_thunk_n(void* state,
+                                 std::span<const CandidateRef> cands,
+                                 const PacketContext& pkt) noexcept {
+        auto* p = static_cast<Policy*>(state);
+        // Candidate set resized since publish: stay correct via the generic path.
+        if (cands.size() != N) [[unlikely]] return p->choose(cands, pkt);
+        return p->template choose_n<N>(cands.template first<N>(), pkt);
+    }
+
+    /// Pick the thunk for @p n_cands once, at publish time.
+    template <typename Policy>
+    inline ChooseFn pick_thunk(std::size_t n_cands) noexcept {
+        if constexpr (FixedCountPolicy<Policy>) {
+            static_assert(kMinFixedCandidates == 2 && kMaxFixedCandidates == 4);
+            switch (n_cands) {
+                case 2: return &choose_thunk_n<Policy, 2>;
+                case 3: return &choose_thunk_n<Policy, 3>;
+                case 4: return &choose_thunk_n<Policy, 4>;
+                default: break;
+            }
+        }
+        return &choose_thunk<Policy>;
+    }
 }
 
 struct alignas(ALPHA_CACHELINE) PolicyBinding final {
@@ -37,15 +70,27 @@ struct alignas(ALPHA_CACHELINE) PolicyBinding final {
     std::atomic<void*>         state{nullptr};
 };
 
+namespace detail {
+    inline void publish_fn(PolicyBinding& b, ChooseFn fn, void* state) noexcept {
+        const auto start = b.seq.load(std::memory_order_relaxed);
+        b.seq.store(start | 1u, std::memory_order_relaxed);
+        b.state.store(state, std::memory_order_relaxed);
+        b.fn.store(fn, std::memory_order_relaxed);
+        b.seq.store((start | 1u) + 1u, std::memory_order_release);
+    }
+}
+
 /// Control plane operations (publish/clear policies).
 namespace cp {
     template <typename Policy>
     inline void publish_policy(PolicyBinding& b, Policy& policy) noexcept {
-        const auto start = b.seq.load(std::memory_order_relaxed);
-        b.seq.store(start | 1u, std::memory_order_relaxed);
-        b.state.store(static_cast<void*>(&policy), std::memory_order_relaxed);
-        b.fn.store(&detail::choose_thunk<Policy>, std::memory_order_relaxed);
-        b.seq.store((start | 1u) + 1u, std::memory_order_release);
+        detail::publish_fn(b, &detail::choose_thunk<Policy>, static_cast<void*>(&policy));
+    }
+    /// Publish for a service with exactly @p n_cands candidates: 2..4 bind the
+    /// unrolled choose_n<N>() when the policy has one, anything else the generic choose().
+    template <typename Policy>
+    inline void publish_policy(PolicyBinding& b, Policy& policy, std::size_t n_cands) noexcept {
+        detail::publish_fn(b, detail::pick_thunk<Policy>(n_cands), static_cast<void*>(&policy));
     }
     void clear_policy(PolicyBinding& b) noexcept;
 }
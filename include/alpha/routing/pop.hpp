@@ -28,6 +28,15 @@ enum class Health : std::uint8_t {
   Down = 2
 };
 
+/**
+ * @brief Shared-risk-group membership: bit g set = depends on group g.
+ *
+ * A shared-risk group (SRLG) is anything whose failure takes several paths
+ * down together: a fibre span, a conduit, a transit provider, a facility.
+ * Group numbering is operator-assigned (0..63); see srlg.hpp.
+ */
+using SrlgMask = std::uint64_t;
+
 /**
  * @brief Minimal PoP descriptor.
  *
@@ -54,6 +63,9 @@ struct Pop final {
   /// Reported health (default = Up).
   Health health{Health::Up};
 
+  /// Shared-risk groups this PoP depends on (default = none).
+  SrlgMask srlg{0};
+
   /// Structural equality (compares all fields).
   bool operator==(const Pop&) const = default;
 };
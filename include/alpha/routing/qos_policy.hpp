@@ -6,12 +6,17 @@
  *          based on normalized latency/jitter/loss vs class targets.
  */
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
 #include <unordered_map>
 #include <optional>
 
+#include "alpha/routing/forecast.hpp"
+
 namespace alpha::routing {
 
 /**
@@ -45,6 +50,96 @@ struct QoSWeights {
     double loss{0.1};     ///< Weight of loss component
 };
 
+/// Number of QoSClass values (array-indexed tables below).
+inline constexpr std::size_t kQoSClassCount = 4;
+
+/**
+ * @struct QoSProfile
+ * @brief Literal (constexpr-friendly) form of a QoS configuration, indexed by QoSClass.
+ * @details Used for compile-time embedded profiles; see alpha/config/policy_tables.hpp.
+ */
+struct QoSProfile {
+    std::array<QoSThresholds, kQoSClassCount> thresholds{}; ///< Targets per class
+    QoSWeights                                weights{};    ///< Blend weights
+    std::array<uint8_t, kQoSClassCount>       dscp{};       ///< DSCP (6 bits) per class
+    uint8_t dscp_mapped{(1u << kQoSClassCount) - 1};        ///< Bit c: class c has a DSCP (else not in class_by_dscp)
+};
+
+/**
+ * @struct QoSTables
+ * @brief Derived, read-only lookup tables used on the scoring path.
+ * @details Built by build_qos_tables() at compile time (embedded profiles) or at
+ *          runtime (config overrides). No maps, no divisions by thresholds.
+ */
+struct QoSTables {
+    std::array<QoSThresholds, kQoSClassCount> thresholds{};      ///< Raw targets (compliance checks)
+    std::array<uint64_t, kQoSClassCount>      inv_latency_q32{}; ///< 2^32 / max_latency_us (0 if target is 0)
+    std::array<uint64_t, kQoSClassCount>      inv_jitter_q32{};  ///< 2^32 / max_jitter_us (0 if target is 0)
+    std::array<double, kQoSClassCount>        inv_loss{};        ///< 1 / max_loss (0 if target <= 0)
+    double w_latency{0.0};  ///< Weight / sum of weights
+    double w_jitter{0.0};   ///< Weight / sum of weights
+    double w_loss{0.0};     ///< Weight / sum of weights
+    std::array<uint8_t, kQoSClassCount>       dscp_by_class{};   ///< Class → DSCP
+    std::array<QoSClass, 64>                  class_by_dscp{};   ///< DSCP → class (unmapped → BestEffort)
+};
+
+/**
+ * @brief Build QoSTables from a profile (constexpr: usable for static tables).
+ * @note If two classes share a DSCP, the higher class wins in class_by_dscp. Classes
+ *       without a DSCP (dscp_mapped) are left out, so their flattened 0 does not claim DSCP 0.
+ */
+constexpr QoSTables build_qos_tables(const QoSProfile& p) noexcept {
+    constexpr uint64_t one_q32 = uint64_t{1} << 32;
+    QoSTables t{};
+    for (std::size_t c = 0; c < kQoSClassCount; ++c) {
+        const QoSThresholds& th = p.thresholds[c];
+        t.thresholds[c]      = th;
+        t.inv_latency_q32[c] = th.max_latency_us ? one_q32 / th.max_latency_us : 0;
+        t.inv_jitter_q32[c]  = th.max_jitter_us  ? one_q32 / th.max_jitter_us  : 0;
+        t.inv_loss[c]        = th.max_loss > 0.0 ? 1.0 / th.max_loss : 0.0;
+        t.dscp_by_class[c]   = static_cast<uint8_t>(p.dscp[c] & 0x3F);
+    }
+    t.class_by_dscp.fill(QoSClass::BestEffort);
+    for (std::size_t c = 0; c < kQoSClassCount; ++c) {
+        if (p.dscp_mapped & (1u << c)) t.class_by_dscp[t.dscp_by_class[c]] = static_cast<QoSClass>(c);
+    }
+
+    const QoSWeights& w = p.weights;
+    const double sumw = std::max(1e-9, w.latency + w.jitter + w.loss);
+    t.w_latency = w.latency / sumw;
+    t.w_jitter  = w.jitter  / sumw;
+    t.w_loss    = w.loss    / sumw;
+    return t;
+}
+
+/// Normalize a Q32 ratio (value/target): <= 1 → 1.0, above → 1/ratio. inv_q32 == 0 → 0.0.
+constexpr double qos_normalize_q32(uint32_t value, uint64_t inv_q32) noexcept {
+    if (inv_q32 == 0) return 0.0; // target 0: treat as non-compliant
+    const uint64_t ratio_q32 = uint64_t{value} * inv_q32;
+    return ratio_q32 <= (uint64_t{1} << 32) ? 1.0 : 4294967296.0 / static_cast<double>(ratio_q32);
+}
+
+/**
+ * @brief Blended score in [0,1] for raw metrics under class @p clazz.
+ * @details Allocation-free; usable directly on a static constexpr QoSTables.
+ */
+constexpr double qos_score(const QoSTables& t, QoSClass clazz,
+                           uint32_t latency_us, uint32_t jitter_us, double loss) noexcept {
+    const auto c = std::min<std::size_t>(static_cast<std::size_t>(clazz), kQoSClassCount - 1);
+    const double nlat  = qos_normalize_q32(latency_us, t.inv_latency_q32[c]);
+    const double njit  = qos_normalize_q32(jitter_us,  t.inv_jitter_q32[c]);
+    const double ratio = loss * t.inv_loss[c];
+    const double nloss = t.inv_loss[c] == 0.0 ? 0.0 : (ratio <= 1.0 ? 1.0 : 1.0 / ratio);
+    return std::clamp(nlat * t.w_latency + njit * t.w_jitter + nloss * t.w_loss, 0.0, 1.0);
+}
+
+/// True if all metrics meet the class targets.
+constexpr bool qos_within(const QoSTables& t, QoSClass clazz,
+                          uint32_t latency_us, uint32_t jitter_us, double loss) noexcept {
+    const auto& th = t.thresholds[std::min<std::size_t>(static_cast<std::size_t>(clazz), kQoSClassCount - 1)];
+    return latency_us <= th.max_latency_us && jitter_us <= th.max_jitter_us && loss <= th.max_loss;
+}
+
 /**
  * @struct PathMetrics
  * @brief Snapshot of path health metrics supplied by the telemetry collector.
@@ -76,15 +171,33 @@ struct QoSConfig {
     std::unordered_map<QoSClass, uint8_t> dscp_by_class;             ///< DSCP (6 bits) per class
 };
 
+/// Flatten a map-based config (unmapped classes get QoSThresholds{} / DSCP 0, cleared in dscp_mapped).
+QoSProfile to_profile(const QoSConfig& cfg);
+
+/// Expand a profile into a map-based config (all thresholds; DSCP for mapped classes).
+QoSConfig to_config(const QoSProfile& p);
+
 /**
  * @class QoSPolicy
  * @brief Concrete QoS policy. Thread-safe for concurrent readers.
  */
 class QoSPolicy {
 public:
-    /** @brief Construct with an initial configuration. */
+    /** @brief Construct with an initial configuration (tables are compiled at runtime). */
     explicit QoSPolicy(QoSConfig cfg) noexcept;
 
+    /** @brief Construct from a compile-time profile and its prebuilt tables (no table build). */
+    QoSPolicy(const QoSProfile& profile, const QoSTables& tables);
+
+    /**
+     * @brief Map a DSCP codepoint back to its class.
+     * @return Class configured for @p dscp; BestEffort if unmapped.
+     */
+    QoSClass class_of(uint8_t dscp) const noexcept { return tab_.class_by_dscp[dscp & 0x3F]; }
+
+    /** @brief Tables currently used for scoring. */
+    const QoSTables& tables() const noexcept { return tab_; }
+
     /**
      * @brief Lookup DSCP codepoint (6 bits) for a class.
      * @param clazz Traffic class.
@@ -100,6 +213,16 @@ public:
      */
     QoSScore score_path(const PathMetrics& pm, QoSClass clazz) const noexcept;
 
+    /**
+     * @brief Score a path on its forecast over the next @p horizon ticks.
+     * @details Latency and loss are the worse of @p pm and the forecast at the horizon (a
+     *          damped linear trend peaks at an end of the interval), so an improving trend
+     *          earns no credit before it shows up. Jitter is taken from @p pm.
+     * @param series Index of the path's series in @p f.
+     */
+    QoSScore score_path(const PathMetrics& pm, QoSClass clazz, const MetricForecaster& f,
+                        std::size_t series, std::uint32_t horizon) const noexcept;
+
     /**
      * @brief Choose the best candidate among paths.
      * @param candidates List of candidate path metrics.
@@ -120,19 +243,9 @@ public:
      */
     void update_config(QoSConfig cfg) noexcept;
 
-private:
-    /** @brief Normalize latency vs. target; <= target → ~1.0, otherwise decays toward 0. */
-    static double normalize_latency(uint32_t latency_us, uint32_t target_us) noexcept;
-    /** @brief Normalize jitter vs. target; <= target → ~1.0, otherwise decays toward 0. */
-    static double normalize_jitter(uint32_t jitter_us,  uint32_t target_us) noexcept;
-    /** @brief Normalize loss vs. target; <= target → ~1.0, otherwise decays toward 0. */
-    static double normalize_loss(double loss,            double target) noexcept;
-
-    /** @brief Blend normalized components with weights and clamp to [0,1]. */
-    static double blend(double nlat, double njit, double nloss, const QoSWeights& w) noexcept;
-
 private:
     QoSConfig cfg_; ///< Read-mostly; replaced wholesale via update_config()
+    QoSTables tab_; ///< Derived from cfg_; what the scoring path reads
 };
 
 } // namespace alpha::routing
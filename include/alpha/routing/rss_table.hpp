@@ -0,0 +1,225 @@
+#pragma once
+/**
+ * @file rss_table.hpp
+ * @brief RSS-style indirection table (hash bucket → worker) with load-driven rebalancing.
+ * @details Replaces static `flow_hash % workers` sharding. The data plane reads the
+ *          bucket owner and bumps per-bucket counters; the control plane moves hot
+ *          buckets to cold workers. Flow pins for a moved bucket are handed over
+ *          through a phased migration so sticky paths survive the move.
+ */
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "alpha/config/constants.hpp"
+#include "alpha/routing/flow_table.hpp"
+
+#ifndef ALPHA_CACHELINE
+#define ALPHA_CACHELINE 64
+#endif
+
+namespace alpha::routing {
+
+/// Data-plane worker index.
+using WorkerId = std::uint16_t;
+
+/// Number of indirection buckets (power-of-two).
+inline constexpr std::size_t kRssBuckets = alpha::config::constants::RSS_INDIRECTION_BUCKETS;
+static_assert((kRssBuckets & (kRssBuckets - 1)) == 0, "RSS bucket count must be a power-of-two");
+
+/// Migrations that may be in flight at once.
+inline constexpr std::size_t kRssMaxInflightMigrations = 8;
+
+/** @struct BucketMove
+ *  @brief One planned bucket reassignment.
+ */
+struct BucketMove final {
+    std::uint16_t bucket{0};
+    WorkerId      from{0};
+    WorkerId      to{0};
+};
+
+/** @struct RebalanceConfig
+ *  @brief Knobs for the greedy rebalancer.
+ */
+struct RebalanceConfig final {
+    double        target_ratio{alpha::config::constants::RSS_REBALANCE_TARGET_RATIO}; ///< Acceptable max/mean
+    std::uint32_t max_moves{alpha::config::constants::RSS_MAX_MOVES_PER_ROUND};       ///< Moves per round
+};
+
+/**
+ * @enum MigrationPhase
+ * @brief Bucket handover protocol. Each phase is executed by exactly one worker
+ *        at its burst boundary, so flow tables stay single-writer.
+ *
+ *  - Export: old owner copies the bucket's flow pins into the handoff, announces Import,
+ *            then flips the owner.
+ *  - Import: new owner installs pins it does not already have. Also run from the new
+ *            owner's miss path (RssTable::adopt()), so no packet of the bucket is
+ *            pinned afresh before the handoff is in.
+ *  - Purge:  old owner drops its copies (late packets from its backlog hit them until then).
+ */
+enum class MigrationPhase : std::uint8_t { Idle = 0, Export, Import, Purge };
+
+/**
+ * @class RssTable
+ * @brief Shared indirection table: DP reads owners and records load, CP plans and starts moves.
+ *
+ * Thread roles:
+ *  - Dispatcher (RX): worker_of() — one acquire load.
+ *  - Worker w: record(w, ...) on its own counter row; service_migrations(w, ...) per burst.
+ *  - Control plane: collect_load(), begin_migration(), owners().
+ *
+ * Worker run-loop contract: call service_migrations() once per burst, and adopt() on a
+ * flow-table miss before choosing a path. Import is published before the owner flip, so
+ * a packet dispatched to the new owner always finds the handoff, whichever order the
+ * worker dequeues and services in.
+ */
+class RssTable final {
+public:
+    /**
+     * @brief Build a table spreading buckets round-robin over @p workers.
+     * @param workers Number of workers (>= 1).
+     * @param handoff_capacity Flow pins preallocated per migration slot.
+     */
+    explicit RssTable(WorkerId workers,
+                      std::size_t handoff_capacity = alpha::config::constants::RSS_HANDOFF_FLOWS_PER_MOVE);
+
+    RssTable(const RssTable&)            = delete;
+    RssTable& operator=(const RssTable&) = delete;
+
+    /// @brief Bucket for a flow hash (low bits; path policies consume the high bits).
+    static constexpr std::uint32_t bucket_of(std::uint32_t flow_hash) noexcept {
+        return flow_hash & static_cast<std::uint32_t>(kRssBuckets - 1);
+    }
+
+    /// @brief Hot path: worker currently owning the flow's bucket.
+    WorkerId worker_of(std::uint32_t flow_hash) const noexcept {
+        return owner_[bucket_of(flow_hash)].load(std::memory_order_acquire);
+    }
+
+    /// @brief Hot path: account @p packets to @p bucket on @p self's counter row (single writer).
+    void record(WorkerId self, std::uint32_t bucket, std::uint32_t packets = 1) noexcept {
+        auto& c = rows_[self].packets[bucket];
+        c.store(c.load(std::memory_order_relaxed) + packets, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Worker burst-boundary hook: run any migration phase assigned to @p self.
+     * @return Number of phases executed (0 in steady state).
+     */
+    std::size_t service_migrations(WorkerId self, FlowTable& flows) noexcept;
+
+    /**
+     * @brief Worker miss path: if @p flow_hash's bucket is being handed to @p self, install
+     *        the handoff now (the Import phase, ahead of the burst boundary).
+     * @return true if pins were imported; the caller repeats its flow-table lookup.
+     */
+    bool adopt(WorkerId self, std::uint32_t flow_hash, FlowTable& flows) noexcept;
+
+    /**
+     * @brief CP: load per bucket since the previous call (deltas of monotonic counters).
+     * @param out Receives kRssBuckets packet counts.
+     */
+    void collect_load(std::span<std::uint64_t, kRssBuckets> out) noexcept;
+
+    /// @brief CP: snapshot of bucket owners.
+    void owners(std::span<WorkerId, kRssBuckets> out) const noexcept;
+
+    /**
+     * @brief CP: start handing @p mv.bucket from @p mv.from to @p mv.to.
+     * @return false if no migration slot is free, the bucket is already moving,
+     *         or @p mv.from no longer owns it.
+     */
+    bool begin_migration(const BucketMove& mv) noexcept;
+
+    /// @brief True if @p bucket has a migration in flight.
+    bool migrating(std::uint32_t bucket) const noexcept;
+
+    /// @brief Number of workers.
+    WorkerId workers() const noexcept { return workers_; }
+
+    /// @brief Flow pins dropped because a handoff overflowed (they re-pin at the new owner).
+    std::uint64_t handoff_dropped() const noexcept { return handoff_dropped_.load(std::memory_order_relaxed); }
+
+private:
+    struct alignas(ALPHA_CACHELINE) CounterRow {
+        std::array<std::atomic<std::uint32_t>, kRssBuckets> packets{};
+    };
+
+    /// Phase and move packed into one word, so any worker reads a consistent pair
+    /// even while the control plane reuses the slot.
+    struct SlotState {
+        MigrationPhase phase{MigrationPhase::Idle};
+        std::uint16_t  bucket{0};
+        WorkerId       from{0};
+        WorkerId       to{0};
+
+        static constexpr std::uint64_t pack(SlotState s) noexcept {
+            return std::uint64_t{static_cast<std::uint8_t>(s.phase)} | std::uint64_t{s.bucket} << 8 |
+                   std::uint64_t{s.from} << 24 | std::uint64_t{s.to} << 40;
+        }
+        static constexpr SlotState unpack(std::uint64_t w) noexcept {
+            return {static_cast<MigrationPhase>(w & 0xFF), static_cast<std::uint16_t>(w >> 8),
+                    static_cast<WorkerId>(w >> 24), static_cast<WorkerId>(w >> 40)};
+        }
+    };
+
+    struct alignas(ALPHA_CACHELINE) MigrationSlot {
+        std::atomic<std::uint64_t> state{0};   ///< SlotState::pack(); 0 = Idle
+        std::vector<FlowEntry>     handoff;    ///< Reserved once; never grows past capacity
+    };
+
+    /// Import step for @p m (state @p s): install missing pins, hand the slot to Purge.
+    static void import_handoff(MigrationSlot& m, SlotState s, FlowTable& flows) noexcept;
+
+    WorkerId                                                 workers_{1};
+    std::size_t                                              handoff_capacity_{0};
+    std::array<std::atomic<WorkerId>, kRssBuckets>           owner_{};
+    std::unique_ptr<CounterRow[]>                            rows_;
+    std::array<MigrationSlot, kRssMaxInflightMigrations>     migrations_{};
+    std::array<std::uint32_t, kRssBuckets>                   prev_total_{}; ///< CP-only: last collected sums
+    std::atomic<std::uint64_t>                               handoff_dropped_{0};
+};
+
+/**
+ * @class RssRebalancer
+ * @brief Control-plane planner: greedily moves hot buckets to the coldest worker.
+ */
+class RssRebalancer final {
+public:
+    explicit RssRebalancer(RebalanceConfig cfg = {}) noexcept : cfg_(cfg) {}
+
+    /**
+     * @brief Plan up to cfg.max_moves bucket moves that bring max/mean toward 1.
+     * @param bucket_load Load per bucket over the last interval.
+     * @param owner Current owner per bucket.
+     * @param workers Worker count.
+     * @param skip Optional predicate-like table: buckets with a non-zero entry are not moved.
+     */
+    std::vector<BucketMove> plan(std::span<const std::uint64_t, kRssBuckets> bucket_load,
+                                 std::span<const WorkerId, kRssBuckets> owner,
+                                 WorkerId workers,
+                                 std::span<const std::uint8_t> skip = {}) const;
+
+    /**
+     * @brief One full CP round: collect load, plan, start migrations.
+     * @return Number of migrations started.
+     */
+    std::size_t run_once(RssTable& table) const;
+
+    /// @brief max/mean of @p worker_load (1.0 = perfectly balanced; 1.0 if idle).
+    static double imbalance(std::span<const std::uint64_t> worker_load) noexcept;
+
+    const RebalanceConfig& config() const noexcept { return cfg_; }
+
+private:
+    RebalanceConfig cfg_{};
+};
+
+} // namespace alpha::routing
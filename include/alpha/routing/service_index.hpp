@@ -0,0 +1,89 @@
+#pragma once
+/**
+ * @file service_index.hpp
+ * @brief Compiled, read-only index over a ServiceRegistry snapshot (service id → dense handle).
+ * @details Built by the control plane whenever the registry version changes and
+ *          published to workers as an immutable object (RCU via shared_ptr, like the
+ *          registry itself). Lookups never allocate; burst lookups overlap cache misses.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "alpha/routing/service_registry.hpp"
+
+namespace alpha::routing {
+
+/// Dense service handle: index into per-service data-plane arrays.
+using ServiceHandle = std::uint32_t;
+
+/// Returned for unknown services.
+inline constexpr ServiceHandle kInvalidService = 0xFFFFFFFFu;
+
+/**
+ * @class ServiceIndex
+ * @brief Open-addressing table of 64-bit id hashes with handles sorted by id.
+ *
+ * Handles are assigned in lexicographic id order, so the same registry content
+ * always compiles to the same handles.
+ */
+class ServiceIndex final {
+public:
+    /// @brief Keys hashed and prefetched together by find_burst().
+    static constexpr std::size_t kPrefetchGroup = 16;
+
+    /// @brief Compile the registry's current snapshot.
+    static std::shared_ptr<const ServiceIndex> compile(const ServiceRegistry& reg);
+
+    /// @brief Compile a specific snapshot (tagged with @p version).
+    static std::shared_ptr<const ServiceIndex>
+    compile(std::shared_ptr<const ServiceRegistry::Map> snap, std::uint64_t version);
+
+    /// @brief Scalar lookup; kInvalidService if absent.
+    ServiceHandle find(std::string_view id) const noexcept;
+
+    /**
+     * @brief Burst lookup: hash all ids, prefetch their slots, then compare.
+     * @param out One handle per id; must be >= ids.size().
+     */
+    void find_burst(std::span<const std::string_view> ids, std::span<ServiceHandle> out) const noexcept;
+
+    /// @brief Number of services.
+    std::size_t size() const noexcept { return ids_.size(); }
+
+    /// @brief Service id for a handle (valid while this index is alive).
+    std::string_view id(ServiceHandle h) const noexcept { return ids_[h]; }
+
+    /// @brief PoPs for a handle (owned by the snapshot this index pins).
+    const PopList& pops(ServiceHandle h) const noexcept { return *pops_[h]; }
+
+    /// @brief Registry version this index was compiled from.
+    std::uint64_t version() const noexcept { return version_; }
+
+    /// @brief Hash used for ids (exposed so callers can precompute).
+    static std::uint64_t hash_id(std::string_view id) noexcept;
+
+private:
+    struct Slot {
+        std::uint64_t hash{0};                 ///< 0 = empty (hash_id never returns 0)
+        ServiceHandle handle{kInvalidService};
+        std::uint32_t len{0};                  ///< id length: cheap reject before string compare
+    };
+
+    ServiceIndex() = default;
+
+    ServiceHandle probe(std::uint64_t h, std::string_view id) const noexcept;
+
+    std::shared_ptr<const ServiceRegistry::Map> snap_;   ///< Keeps ids/PoPs alive
+    std::vector<Slot>                           slots_;
+    std::size_t                                 mask_{0};
+    std::vector<std::string_view>               ids_;
+    std::vector<const PopList*>                 pops_;
+    std::uint64_t                               version_{0};
+};
+
+} // namespace alpha::routing
@@ -132,6 +132,16 @@ public:
     template <class PopLike>
     bool addServiceBool(std::string_view service_id, std::span<const PopLike> pops_like);
 
+    // --------------------------- Snapshot transfer ---------------------------
+    /// Encode the current snapshot into @p out (compact binary, bounded by Limits).
+    /// Used to carry the registry across a hitless restart. Returns bytes written,
+    /// or 0 if @p out is too small.
+    [[nodiscard]] std::size_t serializeSnapshot(std::span<std::byte> out) const noexcept;
+
+    /// Replace all services with an encoded snapshot in a single publish.
+    /// Every service is re-validated; nothing is published on error.
+    RegistryErr restoreSnapshot(std::span<const std::byte> in);
+
     // --------------------------- Observability -------------------------------
     /// Stats counters (atomic, cumulative since start).
     struct Stats {
@@ -0,0 +1,159 @@
+#pragma once
+/**
+ * @file shortest_path.hpp
+ * @brief Dynamic shortest paths on the PoP graph: incremental updates on edge changes, RCU-published trees.
+ * @details One shortest-path tree per source PoP. Edge changes are queued with set_edge()
+ *          (or diffed from an OverlayMatrix by load()) and applied by apply(), Ramalingam–
+ *          Reps style, per source:
+ *            - decrease / new edge (u, v): if it shortens v, Dijkstra from v over the
+ *              nodes that improve; nothing else is looked at;
+ *            - increase / removed edge (u, v): only if it is v's tree edge. The subtree
+ *              under v is the affected set: each affected node restarts from its best
+ *              unaffected in-neighbour and a Dijkstra confined to the set settles them.
+ *          Work is proportional to the affected region, not the graph, so control-plane
+ *          CPU follows churn. Past a configurable batch size apply() rebuilds instead.
+ *
+ *          Readers see immutable ShortestPathSnapshot objects: rows (one per source) are
+ *          copy-on-write, a publish copies only the rows that changed and swaps the
+ *          snapshot pointer once, so all entries of a batch become visible together.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "alpha/routing/overlay.hpp"
+
+namespace alpha::routing {
+
+/**
+ * @class ShortestPathSnapshot
+ * @brief Published distances and trees (any number of concurrent readers).
+ */
+class ShortestPathSnapshot final {
+public:
+    /// Distance of an unreachable destination.
+    static constexpr std::uint64_t kUnreachable = ~std::uint64_t{0};
+
+    /// @brief Distance from @p src to @p dst (kUnreachable if none or @p src is not a source).
+    std::uint64_t distance(PopIndex src, PopIndex dst) const noexcept {
+        const Row* r = row(src);
+        return (r && dst < r->dist.size()) ? r->dist[dst] : kUnreachable;
+    }
+
+    /// @brief First PoP after @p src on the path to @p dst (kNoRelay if unreachable).
+    PopIndex next_hop(PopIndex src, PopIndex dst) const noexcept;
+
+    /**
+     * @brief Hops src, ..., dst of the shortest path into @p out.
+     * @return Number of hops written; 0 if unreachable or @p out is too short.
+     */
+    std::size_t path(PopIndex src, PopIndex dst, std::span<PopIndex> out) const noexcept;
+
+    std::size_t   pops() const noexcept { return rows_.size(); }
+    std::uint64_t version() const noexcept { return version_; }
+
+private:
+    friend class ShortestPaths;
+
+    struct Row {
+        std::vector<std::uint64_t> dist;
+        std::vector<PopIndex>      parent;   ///< kNoRelay for the source and unreachable nodes
+    };
+
+    const Row* row(PopIndex src) const noexcept { return src < rows_.size() ? rows_[src].get() : nullptr; }
+
+    std::vector<std::shared_ptr<const Row>> rows_;   ///< By source PoP; null if not a source
+    std::uint64_t                           version_{0};
+};
+
+/**
+ * @class ShortestPaths
+ * @brief Control-plane owner of the PoP graph and one shortest-path tree per source (single writer).
+ */
+class ShortestPaths final {
+public:
+    /// Weight of an absent edge.
+    static constexpr std::uint32_t kNoEdge = 0xFFFFFFFFu;
+
+    /// Work done by the last apply().
+    struct Stats {
+        std::size_t changes{0};        ///< Edge changes applied
+        std::size_t recomputed{0};     ///< (source, destination) entries revisited
+        std::size_t rows{0};           ///< Source rows republished
+        bool        rebuilt{false};    ///< Batch exceeded the threshold: full recompute
+    };
+
+    /**
+     * @param pops Graph size (at most kOverlayMaxPops); no edges initially.
+     * @param sources PoPs to keep trees for (empty: every PoP).
+     * @param rebuild_after Batches larger than this rebuild every tree (0: pops).
+     */
+    explicit ShortestPaths(std::size_t pops, std::span<const PopIndex> sources = {}, std::size_t rebuild_after = 0);
+
+    /// @brief Queue a weight change for @p u → @p v (kNoEdge removes it). False if out of range.
+    bool set_edge(PopIndex u, PopIndex v, std::uint32_t weight);
+
+    /// @brief Queue every leg whose class cost in @p m differs from the current graph.
+    void load(const OverlayMatrix& m, const OverlayClass& cls);
+
+    /// @brief Apply queued changes incrementally and publish the changed rows in one snapshot.
+    Stats apply();
+
+    /// @brief Recompute every tree from scratch and publish.
+    void rebuild();
+
+    /// @brief Current snapshot (RCU pin; any thread). Never null.
+    std::shared_ptr<const ShortestPathSnapshot> current() const noexcept {
+        return std::atomic_load_explicit(&current_, std::memory_order_acquire);
+    }
+
+    std::uint32_t weight(PopIndex u, PopIndex v) const noexcept { return w_[std::size_t{u} * n_ + v]; }
+    std::size_t   pending() const noexcept { return pending_.size(); }
+
+private:
+    using Row = ShortestPathSnapshot::Row;
+
+    struct Change {
+        PopIndex      u, v;
+        std::uint32_t weight;
+    };
+
+    struct Tree {
+        PopIndex source{0};
+        Row      row;
+        bool     dirty{false};
+    };
+
+    void write_edge(PopIndex u, PopIndex v, std::uint32_t weight);
+    std::size_t decrease(Tree& t, PopIndex u, PopIndex v);
+    std::size_t increase(Tree& t, PopIndex u, PopIndex v);
+    std::size_t settle(Tree& t);
+    bool descends(const Tree& t, PopIndex x, PopIndex ancestor) const noexcept;
+    void full(Tree& t);
+    void publish(bool all);
+
+    void push(std::uint64_t d, PopIndex x);
+
+    std::size_t                         n_;
+    std::size_t                         rebuild_after_;
+    std::vector<std::uint32_t>          w_;       ///< Dense weights [u][v]
+    std::vector<std::vector<PopIndex>>  out_;     ///< Out-neighbours
+    std::vector<std::vector<PopIndex>>  in_;      ///< In-neighbours
+    std::vector<Tree>                   trees_;
+    std::vector<Change>                 pending_;
+
+    // Scratch (kept to avoid per-apply allocation).
+    std::vector<std::pair<std::uint64_t, PopIndex>> heap_;
+    std::vector<std::uint8_t>                       mark_;
+    std::vector<PopIndex>                           stack_, affected_;
+
+    std::uint64_t                                version_{0};
+    std::shared_ptr<const ShortestPathSnapshot>  current_;
+};
+
+} // namespace alpha::routing
@@ -0,0 +1,141 @@
+#pragma once
+/**
+ * @file srlg.hpp
+ * @brief Shared-risk-group aware backups: precomputed disjoint backups and bulk switch on group failure.
+ * @details PoPs and paths carry an SrlgMask (pop.hpp): bit g set means the path depends on
+ *          group g (a fibre span, a transit provider, ...). "Does this backup share a risk
+ *          with the primary" is then a single AND, "how much" a popcount.
+ *
+ *          SrlgBackupTable keeps, per service, its candidate paths and the active one, and
+ *          precomputes a backup: the usable candidate with the fewest groups in common with
+ *          the active path (none whenever a disjoint one exists), best score first. A
+ *          per-group index lists the services whose active or backup path is in that group,
+ *          so fail_groups() touches only the affected services and switches all of them in
+ *          one control-plane pass; the caller publishes the returned batch as one update.
+ *
+ *          Single writer (control plane); not thread-safe.
+ */
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "alpha/routing/failover_policy.hpp"
+#include "alpha/routing/pop.hpp"
+
+namespace alpha::routing {
+
+/// Number of distinct shared-risk groups (bits of SrlgMask).
+inline constexpr std::size_t kSrlgGroups = 64;
+
+/// Mask with only group @p g set (0 if out of range).
+constexpr SrlgMask srlg_bit(std::size_t g) noexcept { return g < kSrlgGroups ? SrlgMask{1} << g : 0; }
+
+/// Number of groups @p a and @p b have in common.
+constexpr int srlg_shared(SrlgMask a, SrlgMask b) noexcept { return std::popcount(a & b); }
+
+/// One candidate path of a service.
+struct SrlgCandidate final {
+    std::string path_id;
+    SrlgMask    srlg{0};        ///< Groups the path traverses (union of its PoPs' and links' groups)
+    double      score{0.0};     ///< QoS score (higher is better)
+    bool        usable{true};   ///< False while the path is Down for other reasons
+};
+
+/// A switch made by fail_groups().
+struct SrlgSwitch final {
+    std::string      service_id;
+    FailoverDecision decision;    ///< reason "srlg_failure"; next_path_id empty if nothing survives
+};
+
+/**
+ * @class SrlgBackupTable
+ * @brief Per-service active path and precomputed SRLG-aware backup, indexed by risk group.
+ */
+class SrlgBackupTable final {
+public:
+    /**
+     * @brief Add or replace a service.
+     * @param active Path currently carrying the service; must be one of @p candidates.
+     * @return False (nothing changed) if @p active is not a candidate.
+     */
+    bool set_service(std::string_view service_id, std::vector<SrlgCandidate> candidates, std::string_view active);
+
+    /// @brief Remove a service. False if unknown.
+    bool remove_service(std::string_view service_id);
+
+    /// @brief Refresh one candidate's score and health and re-pick the service's backup.
+    bool update(std::string_view service_id, std::string_view path_id, double score, bool usable);
+
+    /// @brief Record a switch decided elsewhere (e.g. FailoverPolicy::evaluate).
+    bool set_active(std::string_view service_id, std::string_view path_id);
+
+    /**
+     * @brief Mark @p groups failed and move every service whose active path is in one of them.
+     * @details Affected services take their precomputed backup if it avoids every failed
+     *          group, otherwise the best candidate that does. Services whose backup was hit
+     *          get a new backup. One pass; returns the switches as one batch.
+     */
+    std::vector<SrlgSwitch> fail_groups(SrlgMask groups);
+
+    /// @brief Clear @p groups from the failed set and re-pick backups (actives stay where they are).
+    void restore_groups(SrlgMask groups);
+
+    /// Active path of a service (null if unknown).
+    const SrlgCandidate* active(std::string_view service_id) const noexcept;
+
+    /// Precomputed backup of a service (null if unknown or no usable candidate).
+    const SrlgCandidate* backup(std::string_view service_id) const noexcept;
+
+    /// Number of services whose active path is in any of @p groups.
+    std::size_t exposed(SrlgMask groups) const noexcept;
+
+    SrlgMask    failed() const noexcept { return failed_; }
+    std::size_t size() const noexcept { return services_.size(); }
+
+private:
+    static constexpr std::uint32_t kNone = 0xFFFFFFFFu;
+
+    struct KeyHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view s) const noexcept { return std::hash<std::string_view>{}(s); }
+    };
+    struct KeyEq {
+        using is_transparent = void;
+        bool operator()(std::string_view a, std::string_view b) const noexcept { return a == b; }
+    };
+
+    struct Service {
+        std::string                id;
+        std::vector<SrlgCandidate> candidates;
+        std::uint32_t              active{0};
+        std::uint32_t              backup{kNone};
+        std::uint32_t              seen{0};     ///< Pass stamp (dedup across groups in fail_groups)
+    };
+
+    Service*       find(std::string_view id) noexcept;
+    const Service* find(std::string_view id) const noexcept;
+
+    /// Best usable candidate outside the failed groups, fewest groups shared with @p avoid, then score.
+    std::uint32_t pick(const Service& s, SrlgMask avoid) const noexcept;
+
+    /// Groups a service is indexed under: its active and backup paths'.
+    static SrlgMask indexed(const Service& s) noexcept;
+
+    void reindex();
+
+    std::vector<Service>                                           services_;
+    std::unordered_map<std::string, std::uint32_t, KeyHash, KeyEq> index_;
+    std::array<std::vector<std::uint32_t>, kSrlgGroups>            by_group_;
+    bool                                                           stale_{false};   ///< by_group_ needs a rebuild
+    SrlgMask                                                       failed_{0};
+    std::uint32_t                                                  pass_{0};
+};
+
+} // namespace alpha::routing
@@ -0,0 +1,147 @@
+#pragma once
+/**
+ * @file switch_scheduler.hpp
+ * @brief Failover storm control: a global per-tick switch budget, priority admission and one publish per tick.
+ * @details During a regional incident thousands of services can get a switch decision in
+ *          the same tick. Applying all of them at once herds them onto the same backups and
+ *          floods the data plane with republishes. Decisions (FailoverPolicy::evaluate,
+ *          SrlgBackupTable::fail_groups, ...) are instead submitted here; tick() admits at
+ *          most max_switches_per_tick of them, at most max_per_target of them onto any one
+ *          path, in priority order:
+ *            1. services whose current path is Down (repairs before optimizations);
+ *            2. higher QoS class first (Realtime, Interactive, BestEffort, Bulk);
+ *            3. oldest submission first.
+ *          The rest stay queued for later ticks; resubmitting a queued service replaces its
+ *          decision but keeps its place. A deferred switch can go stale: the control plane
+ *          reports path health through set_path_state(), and at admission a request whose
+ *          target is now Down is dropped (SwitchBatch::dropped) instead of applied, so the
+ *          caller can evaluate the service again. Admitted switches are applied to the active-path
+ *          table, which is published once per tick as a new generation (RCU via shared_ptr).
+ *
+ *          Single writer (control plane); current() may be called from any thread.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "alpha/config/constants.hpp"
+#include "alpha/routing/failover_policy.hpp"
+#include "alpha/routing/qos_policy.hpp"
+#include "alpha/routing/service_registry.hpp"
+
+namespace alpha::routing {
+
+/// Budget for switches applied per tick.
+struct SwitchBudgetConfig final {
+    std::uint32_t max_switches_per_tick{alpha::config::constants::FAILOVER_MAX_SWITCHES_PER_TICK};   ///< Global cap (0: none)
+    std::uint32_t max_per_target{alpha::config::constants::FAILOVER_MAX_SWITCHES_PER_TARGET};         ///< Cap per next path (0: none)
+};
+
+/// A switch waiting for budget.
+struct SwitchRequest final {
+    std::string      service_id;
+    FailoverDecision decision;                        ///< next_path_id must be set
+    QoSClass         qos_class{QoSClass::BestEffort};
+    bool             current_down{false};             ///< The service's current path is Down
+};
+
+/**
+ * @class ActivePathTable
+ * @brief Published service → active path map; immutable, any number of readers.
+ */
+class ActivePathTable final {
+public:
+    using Map = std::unordered_map<std::string, std::string, ServiceRegistry::SKeyHash, ServiceRegistry::SKeyEq>;
+
+    /// @brief Active path of @p service_id (empty if unknown).
+    std::string_view path_of(std::string_view service_id) const noexcept {
+        const auto it = paths_.find(service_id);
+        return it == paths_.end() ? std::string_view{} : std::string_view{it->second};
+    }
+
+    std::size_t   size() const noexcept { return paths_.size(); }
+    std::uint64_t generation() const noexcept { return generation_; }
+
+private:
+    friend class SwitchScheduler;
+
+    Map           paths_;
+    std::uint64_t generation_{0};
+};
+
+/// Result of one tick.
+struct SwitchBatch final {
+    std::vector<SwitchRequest> applied;        ///< Admitted, in priority order
+    std::vector<SwitchRequest> dropped;        ///< Target Down at admission; not applied, no longer queued
+    std::size_t                deferred{0};    ///< Still queued after this tick
+    std::uint64_t              generation{0};  ///< Generation published (unchanged if nothing was)
+};
+
+/**
+ * @class SwitchScheduler
+ * @brief Rate-limited, prioritized application of failover decisions.
+ */
+class SwitchScheduler final {
+public:
+    explicit SwitchScheduler(SwitchBudgetConfig cfg = {});
+
+    /// @brief Set a service's active path directly (bootstrap, operator action); published at the next tick().
+    void set_active(std::string_view service_id, std::string_view path_id);
+
+    /// @brief Forget a service (and any queued switch); published at the next tick().
+    void remove(std::string_view service_id);
+
+    /**
+     * @brief Queue a switch, replacing the one already queued for the service.
+     * @return False (nothing queued) if the decision has no next path or names the active one.
+     */
+    bool submit(SwitchRequest r);
+
+    /// @brief Drop the queued switch of @p service_id (e.g. the path recovered). False if none.
+    bool cancel(std::string_view service_id);
+
+    /// @brief Record the health of @p path_id (paths never reported count as Up); checked at admission.
+    void set_path_state(std::string_view path_id, HealthState s);
+
+    /// @brief Admit queued switches within budget, apply them, and publish once if anything changed.
+    SwitchBatch tick();
+
+    std::size_t               pending() const noexcept { return queue_.size(); }
+    const SwitchBudgetConfig& config() const noexcept { return cfg_; }
+    void                      update_config(SwitchBudgetConfig c) noexcept { cfg_ = c; }
+
+    /// @brief Current table (RCU pin; any thread). Never null.
+    std::shared_ptr<const ActivePathTable> current() const noexcept {
+        return std::atomic_load_explicit(&current_, std::memory_order_acquire);
+    }
+
+private:
+    struct Queued {
+        SwitchRequest req;
+        std::uint64_t seq{0};   ///< First submission order (kept across replacements)
+    };
+
+    void publish();
+
+    using Index = std::unordered_map<std::string, std::size_t, ServiceRegistry::SKeyHash, ServiceRegistry::SKeyEq>;
+    using PathStates = std::unordered_set<std::string, ServiceRegistry::SKeyHash, ServiceRegistry::SKeyEq>;
+
+    SwitchBudgetConfig                     cfg_;
+    ActivePathTable::Map                   active_;
+    std::vector<Queued>                    queue_;
+    Index                                  queued_;          ///< service → queue_ index
+    std::uint64_t                          seq_{0};
+    std::uint64_t                          generation_{0};
+    bool                                   dirty_{false};    ///< active_ changed since the last publish
+    PathStates                             down_;            ///< Paths last reported Down
+    std::shared_ptr<const ActivePathTable> current_;
+};
+
+} // namespace alpha::routing
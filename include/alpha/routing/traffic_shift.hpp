@@ -0,0 +1,172 @@
+#pragma once
+/**
+ * @file traffic_shift.hpp
+ * @brief Gradual traffic shifting: per-service split ratios applied by flow-hash threshold, ramped in gated steps.
+ * @details A shift moves a service from one path to another in steps instead of all at
+ *          once: return-to-primary (backup → recovered primary) and drains (PoP being
+ *          drained → alternate) are both a shift. The data plane sees one TrafficSplit
+ *          per service: flows whose mixed hash falls below the split's share go to the
+ *          target, the rest stay. The test is a multiply and a compare on the flow hash
+ *          already in the PacketContext: no per-packet or per-flow state. Raising the
+ *          share only moves more flows over; a flow that moved never moves back while
+ *          the ramp goes up.
+ *
+ *          ShiftController (control plane) advances every ramping service once per tick:
+ *          each step waits step_hold_ms and requires the target's metrics to pass the
+ *          gate (healthy, RTT and loss under the configured limits) at that tick. A failed
+ *          gate aborts the shift: the share drops to 0 and all traffic stays on the source,
+ *          so a recovering primary is never slammed with everything at once. All splits
+ *          changed in a tick are published in one SplitTable swap (RCU via shared_ptr).
+ *
+ *          A settled shift (complete or aborted) drops its split in the same publication:
+ *          the event names the path now carrying all of the service's traffic, which the
+ *          caller makes its own choice (e.g. the failover policy's current path). A split
+ *          never outlives its ramp to override a later failover decision.
+ *
+ * Data plane, per packet:
+ *   PathId p = policy.choose(cands, ctx);
+ *   p = splits->route(h, ctx.flow_hash, p);      // splits pinned per burst
+ *
+ * With FlowTable pinning, the split places new flows; existing pins keep their path.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "alpha/config/constants.hpp"
+#include "alpha/routing/candidate_set.hpp"
+#include "alpha/routing/path_selection.hpp"
+#include "alpha/routing/service_index.hpp"
+
+namespace alpha::routing {
+
+/// Full share (parts per million).
+inline constexpr std::uint32_t kShiftFullPpm = 1'000'000;
+
+/// One service's split between two paths (data-plane view).
+struct TrafficSplit final {
+    PathId        from{kInvalidPath};   ///< Path traffic is leaving
+    PathId        to{kInvalidPath};     ///< Path traffic is moving to; kInvalidPath = no split
+    std::uint32_t to_ppm{0};            ///< Share of flows on @c to
+
+    bool active() const noexcept { return to != kInvalidPath; }
+
+    /// Path for a flow. The hash is re-mixed (odd multiply) so the split does not line up
+    /// with FlowHashPolicy's fast_range32() buckets over the same hash.
+    PathId pick(std::uint32_t flow_hash) const noexcept {
+        return fast_range32(flow_hash * 0x9E3779B1u, kShiftFullPpm) < to_ppm ? to : from;
+    }
+};
+
+/**
+ * @class SplitTable
+ * @brief Immutable per-service splits indexed by ServiceHandle; any number of readers.
+ */
+class SplitTable final {
+public:
+    explicit SplitTable(std::vector<TrafficSplit> splits) noexcept : splits_(std::move(splits)) {}
+
+    /// @brief Path for a flow of service @p h: the split's pick, or @p chosen if @p h has no split.
+    PathId route(ServiceHandle h, std::uint32_t flow_hash, PathId chosen) const noexcept {
+        if (h >= splits_.size() || !splits_[h].active()) return chosen;
+        return splits_[h].pick(flow_hash);
+    }
+
+    const TrafficSplit& split(ServiceHandle h) const noexcept { return splits_[h]; }
+    std::size_t         size() const noexcept { return splits_.size(); }
+
+private:
+    std::vector<TrafficSplit> splits_;
+};
+
+/// Ramp parameters and step gate.
+struct ShiftConfig final {
+    std::uint32_t step_ppm{alpha::config::constants::SHIFT_STEP_PPM};          ///< Share moved per step
+    std::uint32_t step_hold_ms{alpha::config::constants::SHIFT_STEP_HOLD_MS};  ///< Dwell at each step
+    std::uint32_t max_rtt_us{std::numeric_limits<std::uint32_t>::max()};        ///< Gate: target RTT ceiling
+    std::uint32_t max_loss_ppm{kShiftFullPpm};                                  ///< Gate: target loss ceiling
+};
+
+/// Lifecycle of a service's shift.
+enum class ShiftState : std::uint8_t { Idle, Ramping, Complete, Aborted };
+
+/// Reported by tick() when a shift completes or aborts (its split is gone from then on).
+struct ShiftEvent final {
+    ServiceHandle service{kInvalidService};
+    ShiftState    state{ShiftState::Idle};
+    std::uint32_t to_ppm{0};            ///< Share on the split's target when the event fired
+    PathId        path{kInvalidPath};   ///< Path now carrying all traffic: the target, or the source on abort
+};
+
+/**
+ * @class ShiftController
+ * @brief Control-plane owner of per-service splits (single writer).
+ */
+class ShiftController final {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief @p services handles (ServiceIndex::size()), all idle.
+    explicit ShiftController(std::size_t services, ShiftConfig cfg = {});
+
+    /**
+     * @brief Carry every service's shift across an index recompile. Publishes.
+     * @details Handles follow sorted ids, so adding or removing one service renumbers the
+     *          ones after it; state moves by service id from @p before to @p after. Services
+     *          missing from @p after lose their shift.
+     */
+    void remap(const ServiceIndex& before, const ServiceIndex& after);
+
+    /**
+     * @brief Start moving service @p h from @p from to @p to; the first step lands after step_hold_ms.
+     * @param step_ppm Share per step (0: config default).
+     * @details Reversing a shift in progress (from/to swapped) ramps the existing split
+     *          back down from its current share, so the flows that already moved are the
+     *          first to return. Takes effect at the next tick().
+     * @return False if @p h is out of range or @p from == @p to.
+     */
+    bool begin(ServiceHandle h, PathId from, PathId to, Clock::time_point now, std::uint32_t step_ppm = 0);
+
+    /// @brief Abandon service @p h's shift (data plane falls back to the policy's choice). Publishes.
+    void release(ServiceHandle h);
+
+    /**
+     * @brief Advance every ramping service against the current metrics and publish once.
+     * @param slots Metrics slots indexed by PathId (e.g. MetricsTable::slots(epoch)).
+     * @param events Completions and aborts are appended here (optional); their splits are dropped.
+     * @return Number of services whose split changed.
+     */
+    std::size_t tick(std::span<const MetricsSlot> slots, Clock::time_point now, std::vector<ShiftEvent>* events = nullptr);
+
+    ShiftState          state(ServiceHandle h) const noexcept { return h < state_.size() ? state_[h] : ShiftState::Idle; }
+    const TrafficSplit& split(ServiceHandle h) const noexcept { return splits_[h]; }
+    std::size_t         ramping() const noexcept { return ramping_.size(); }
+
+    /// @brief Current table (RCU pin; any thread). Never null.
+    std::shared_ptr<const SplitTable> current() const noexcept {
+        return std::atomic_load_explicit(&current_, std::memory_order_acquire);
+    }
+
+private:
+    bool gate(std::span<const MetricsSlot> slots, PathId p) const noexcept;
+    void resize(std::size_t services);
+    void publish();
+
+    ShiftConfig                       cfg_;
+    std::vector<TrafficSplit>         splits_;
+    std::vector<ShiftState>           state_;
+    std::vector<std::uint32_t>        step_;       ///< Per-service step share
+    std::vector<PathId>               target_;     ///< Path gaining traffic (split's to, or from when reversed)
+    std::vector<Clock::time_point>    last_;       ///< Last step (or begin) time
+    std::vector<ServiceHandle>        ramping_;    ///< Services with state Ramping
+    std::shared_ptr<const SplitTable> current_;
+};
+
+} // namespace alpha::routing
@@ -0,0 +1,165 @@
+#pragma once
+/**
+ * @file vip_table.hpp
+ * @brief Compiled (VIP, port, protocol) → ServiceHandle table for data-plane service resolution.
+ * @details The registry knows services by id; the data plane sees destinations. The
+ *          control plane keeps the VIP bindings and compiles them against a ServiceIndex
+ *          whenever the registry version (or the binding set) changes. The table is a
+ *          hash-and-displace perfect hash over 56-bit packed keys: a lookup reads one
+ *          displacement (small, cache-resident) and probes exactly one slot.
+ *
+ *          Port 0 in a binding means "any port": find() tries the exact key first and
+ *          the port-0 key only on a miss.
+ *
+ *          Handles equal those of any ServiceIndex compiled from the same registry
+ *          version (handles follow id order), e.g. CandidateSet::index().
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "alpha/compat/expected.hpp"  // alpha_detail::expected / unexpected
+#include "alpha/routing/service_index.hpp"
+#include "alpha/routing/service_registry.hpp"
+
+namespace alpha::routing {
+
+/// Destination a packet is resolved by (host byte order).
+struct VipKey final {
+    std::uint32_t vip{0};
+    std::uint16_t port{0};
+    std::uint8_t  proto{0};
+};
+
+/// Control-plane binding of a destination to a registry service id.
+struct VipBinding final {
+    std::uint32_t vip{0};
+    std::uint16_t port{0};      ///< 0 = any port
+    std::uint8_t  proto{0};
+    std::string   service_id;
+};
+
+/// Compile failures (nothing is published).
+enum class VipError : std::uint8_t {
+    Duplicate = 1,   ///< Same (vip, port, proto) bound twice
+    BuildFailed      ///< No displacement found (practically unreachable; retried with growth)
+};
+
+/**
+ * @class VipTable
+ * @brief Immutable perfect-hash table; any number of concurrent readers.
+ */
+class VipTable final {
+public:
+    /// @brief Keys hashed and prefetched together by find_burst().
+    static constexpr std::size_t kPrefetchGroup = 16;
+
+    /**
+     * @brief Compile @p bindings against @p index.
+     * @note Bindings to services missing from the index are skipped and counted in unresolved().
+     */
+    static alpha_detail::expected<std::shared_ptr<const VipTable>, VipError>
+    compile(std::span<const VipBinding> bindings, std::shared_ptr<const ServiceIndex> index);
+
+    /// @brief Service for @p k (exact port, then any-port binding), or kInvalidService.
+    ServiceHandle find(const VipKey& k) const noexcept {
+        const ServiceHandle h = probe(pack(k.vip, k.port, k.proto));
+        return (h != kInvalidService || !any_port_) ? h : probe(pack(k.vip, 0, k.proto));
+    }
+
+    /**
+     * @brief Burst lookup: hash all keys, prefetch their slots, then compare.
+     * @param out One handle per key; must be >= keys.size().
+     */
+    void find_burst(std::span<const VipKey> keys, std::span<ServiceHandle> out) const noexcept;
+
+    /// @brief Bindings in the table.
+    std::size_t size() const noexcept { return size_; }
+
+    /// @brief Bindings skipped because their service is not in the index.
+    std::size_t unresolved() const noexcept { return unresolved_; }
+
+    /// @brief Index the handles refer to (id lookups, registry version).
+    const ServiceIndex& index() const noexcept { return *index_; }
+
+private:
+    static constexpr std::uint64_t kEmpty = ~std::uint64_t{0};   ///< Packed keys use 56 bits
+
+    struct Slot {
+        std::uint64_t key{kEmpty};
+        ServiceHandle handle{kInvalidService};
+        std::uint32_t pad{0};
+    };
+
+    VipTable() = default;
+
+    static std::uint64_t pack(std::uint32_t vip, std::uint16_t port, std::uint8_t proto) noexcept {
+        return (std::uint64_t{vip} << 24) | (std::uint64_t{port} << 8) | proto;
+    }
+
+    static std::uint64_t mix(std::uint64_t x) noexcept {
+        x ^= x >> 30; x *= 0xBF58476D1CE4E5B9ULL;
+        x ^= x >> 27; x *= 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    /// Map a 64-bit hash onto [0, n) (high bits; no division).
+    static std::size_t range(std::uint64_t h, std::size_t n) noexcept {
+        return static_cast<std::size_t>((h >> 32) * n >> 32);
+    }
+
+    std::size_t bucket_of(std::uint64_t h) const noexcept { return range(h ^ seed_, disp_.size()); }
+
+    std::size_t slot_of(std::uint64_t h, std::uint32_t d) const noexcept {
+        return range(mix(h + d * 0x9E3779B97F4A7C15ULL), slots_.size());
+    }
+
+    ServiceHandle probe(std::uint64_t key) const noexcept {
+        const std::uint64_t h = mix(key ^ seed_);
+        const Slot& s = slots_[slot_of(h, disp_[bucket_of(h)])];
+        return s.key == key ? s.handle : kInvalidService;
+    }
+
+    std::shared_ptr<const ServiceIndex> index_;
+    std::vector<std::uint32_t>          disp_;      ///< Displacement per bucket
+    std::vector<Slot>                   slots_;
+    std::uint64_t                       seed_{0};
+    std::size_t                         size_{0};
+    std::size_t                         unresolved_{0};
+    bool                                any_port_{false};  ///< Some binding uses port 0
+};
+
+/**
+ * @class VipResolver
+ * @brief Control-plane owner of the bindings and the published VipTable.
+ */
+class VipResolver final {
+public:
+    VipResolver();
+
+    /// @brief Replace the binding set; applied by the next refresh().
+    void set_bindings(std::vector<VipBinding> bindings);
+
+    /**
+     * @brief Recompile and publish if the registry version or the bindings changed.
+     * @return true if a new table was published; VipError if the bindings do not compile
+     *         (the previous table stays published).
+     */
+    alpha_detail::expected<bool, VipError> refresh(const ServiceRegistry& reg);
+
+    /// @brief Current table (RCU pin; any thread).
+    std::shared_ptr<const VipTable> current() const noexcept {
+        return std::atomic_load_explicit(&current_, std::memory_order_acquire);
+    }
+
+private:
+    std::vector<VipBinding>         bindings_;
+    bool                            dirty_{false};
+    std::shared_ptr<const VipTable> current_;
+};
+
+} // namespace alpha::routing
@@ -0,0 +1,56 @@
+/**
+ * @file byte_ring.cpp
+ * @brief Setup-time parts of SpscByteRing (factory, move).
+ */
+
+#include "alpha/mem/byte_ring.hpp"
+
+#include <new>
+#include <utility>
+
+namespace alpha::mem {
+
+alpha_detail::expected<SpscByteRing, SpscError>
+SpscByteRing::with_capacity(std::size_t capacity_pow2) noexcept {
+  if (capacity_pow2 < 2 * kRecordAlign) {
+    return alpha_detail::unexpected(SpscError::CapacityZero);
+  }
+  if ((capacity_pow2 & (capacity_pow2 - 1)) != 0) {
+    return alpha_detail::unexpected(SpscError::CapacityNotPowerOfTwo);
+  }
+
+  // Cache-line aligned so record offsets map to predictable lines.
+  auto* raw = static_cast<std::byte*>(::operator new[](capacity_pow2, std::align_val_t(kCacheLine), std::nothrow));
+  if (raw == nullptr) {
+    return alpha_detail::unexpected(SpscError::AllocationFailed);
+  }
+
+  SpscByteRing r;
+  r.storage_ = std::unique_ptr<std::byte[], void(*)(std::byte*)>(
+    raw, [](std::byte* p){ ::operator delete[](p, std::align_val_t(kCacheLine)); });
+  r.buf_      = raw;
+  r.capacity_ = capacity_pow2;
+  r.mask_     = capacity_pow2 - 1;
+  return r;
+}
+
+void SpscByteRing::move_from(SpscByteRing&& other) noexcept {
+  tail_pub_.store(other.tail_pub_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  head_pub_.store(other.head_pub_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+  tail_       = other.tail_;
+  head_cache_ = other.head_cache_;
+  pend_pad_   = other.pend_pad_;
+  pend_max_   = other.pend_max_;
+  head_       = other.head_;
+  tail_cache_ = other.tail_cache_;
+  peek_end_   = other.peek_end_;
+  buf_        = other.buf_;
+  capacity_   = other.capacity_;
+  mask_       = other.mask_;
+  storage_    = std::move(other.storage_);
+  other.buf_ = nullptr;
+  other.capacity_ = 0;
+  other.mask_ = 0;
+}
+
+} // namespace alpha::mem
@@ -0,0 +1,86 @@
+/**
+ * @file clock.cpp
+ * @brief TSC feature checks and calibration against CLOCK_MONOTONIC.
+ */
+#include "alpha/os/clock.hpp"
+
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+namespace alpha::os {
+
+TscClock::State TscClock::state_{};
+
+namespace {
+
+bool counter_invariant() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    // CPUID 0x80000007 EDX[8]: invariant TSC (constant rate, runs in all C/P-states).
+    unsigned a = 0, b = 0, c = 0, d = 0;
+    if (__get_cpuid(0x80000000u, &a, &b, &c, &d) == 0 || a < 0x80000007u) return false;
+    __get_cpuid(0x80000007u, &a, &b, &c, &d);
+    return (d & (1u << 8)) != 0;
+#elif defined(__aarch64__)
+    return true; // generic timer: architected constant frequency
+#else
+    return false;
+#endif
+}
+
+std::int64_t mono_ns() noexcept {
+    using namespace std::chrono;
+    return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Counter and CLOCK_MONOTONIC sampled as close together as possible (tightest of a few tries).
+void paired_sample(std::uint64_t& tsc, std::int64_t& ns) noexcept {
+    std::uint64_t best = ~std::uint64_t{0};
+    for (int i = 0; i < 8; ++i) {
+        const std::uint64_t t0 = TscClock::read_counter();
+        const std::int64_t  n  = mono_ns();
+        const std::uint64_t t1 = TscClock::read_counter();
+        if (t1 - t0 < best) { best = t1 - t0; tsc = t0 + (t1 - t0) / 2; ns = n; }
+    }
+}
+
+} // namespace
+
+TscCalibration TscClock::calibrate(std::chrono::milliseconds window) noexcept {
+    TscCalibration cal{};
+    cal.invariant = counter_invariant();
+    if (!cal.invariant) {
+        state_ = State{};
+        state_.cal = cal;
+        return cal;
+    }
+
+    std::uint64_t t0 = 0, t1 = 0;
+    std::int64_t  n0 = 0, n1 = 0;
+    paired_sample(t0, n0);
+    std::this_thread::sleep_for(window);
+    paired_sample(t1, n1);
+
+    // Reject a counter that did not advance or ran backwards relative to the OS clock.
+    if (t1 <= t0 || n1 <= n0) {
+        state_ = State{};
+        state_.cal = cal;
+        return cal;
+    }
+    const double ns_per_tick = static_cast<double>(n1 - n0) / static_cast<double>(t1 - t0);
+    cal.hz      = static_cast<std::uint64_t>(1e9 / ns_per_tick);
+    cal.enabled = true;
+
+    State s{};
+    s.enabled = true;
+    s.tsc0    = t1;
+    s.ns0     = n1;
+    s.mult    = mult_for(ns_per_tick);
+    s.cal     = cal;
+    state_ = s;
+    return cal;
+}
+
+} // namespace alpha::os
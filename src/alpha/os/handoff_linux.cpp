@@ -0,0 +1,317 @@
+#if defined(__linux__)
+
+/**
+ * @file handoff_linux.cpp
+ * @brief memfd region + SCM_RIGHTS descriptor passing for hitless restart.
+ */
+#include "alpha/os/handoff.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace alpha::os {
+
+namespace {
+
+constexpr std::uint64_t kRegionMagic = 0x314F4841'48504C41ULL; // "ALPHAHO1" (little-endian)
+constexpr std::uint32_t kMsgMagic    = 0x48414E44u;            // "HAND"
+constexpr std::size_t   kAlign       = 64;
+
+struct SectionDesc {
+    std::uint32_t kind{0};
+    std::uint32_t index{0};
+    std::uint64_t offset{0};
+    std::uint64_t bytes{0};
+};
+
+struct RegionHeader {
+    std::uint64_t magic{0};
+    std::uint32_t layout_version{0};
+    std::uint32_t section_count{0};
+    std::uint64_t used{0};     ///< Bump pointer (bytes from region start)
+    std::uint64_t capacity{0};
+    std::array<SectionDesc, kHandoffMaxSections> sections{};
+};
+
+/// Wire header; Offer carries one role per passed descriptor after the region fd.
+struct WireMsg {
+    std::uint32_t magic{kMsgMagic};
+    std::uint32_t op{0};
+    std::uint32_t nfds{0};
+    std::array<std::uint32_t, kHandoffMaxFds> roles{};
+};
+
+constexpr std::size_t align_up(std::size_t v, std::size_t a) noexcept { return (v + a - 1) & ~(a - 1); }
+
+RegionHeader* header_of(void* base) noexcept { return static_cast<RegionHeader*>(base); }
+
+alpha_detail::unexpected<HandoffError> sys_error() noexcept {
+    return alpha_detail::unexpected(HandoffError::SystemError);
+}
+
+bool fill_addr(const std::string& path, sockaddr_un& addr) noexcept {
+    if (path.size() >= sizeof(addr.sun_path)) return false;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+    return true;
+}
+
+void close_all(const std::array<int, kHandoffMaxFds + 1>& fds, std::size_t& nfds) noexcept {
+    for (std::size_t i = 0; i < nfds; ++i) ::close(fds[i]);
+    nfds = 0;
+}
+
+/// Send/recv a WireMsg with optional SCM_RIGHTS descriptors.
+bool send_msg(int sock, const WireMsg& m, std::span<const int> fds) noexcept {
+    iovec iov{const_cast<WireMsg*>(&m), sizeof(m)};
+    msghdr msg{};
+    msg.msg_iov    = &iov;
+    msg.msg_iovlen = 1;
+
+    alignas(cmsghdr) std::array<char, CMSG_SPACE(sizeof(int) * (kHandoffMaxFds + 1))> ctrl{};
+    if (!fds.empty()) {
+        const std::size_t len = sizeof(int) * fds.size();
+        msg.msg_control    = ctrl.data();
+        msg.msg_controllen = CMSG_SPACE(len);
+        cmsghdr* c = CMSG_FIRSTHDR(&msg);
+        c->cmsg_level = SOL_SOCKET;
+        c->cmsg_type  = SCM_RIGHTS;
+        c->cmsg_len   = CMSG_LEN(len);
+        std::memcpy(CMSG_DATA(c), fds.data(), len);
+    }
+    ssize_t n;
+    do { n = ::sendmsg(sock, &msg, MSG_NOSIGNAL); } while (n < 0 && errno == EINTR);
+    return n == static_cast<ssize_t>(sizeof(m));
+}
+
+using FdArray = std::array<int, kHandoffMaxFds + 1>;
+
+bool recv_msg(int sock, WireMsg& m, FdArray& fds, std::size_t& nfds) noexcept {
+    nfds = 0;
+    iovec iov{&m, sizeof(m)};
+    msghdr msg{};
+    msg.msg_iov    = &iov;
+    msg.msg_iovlen = 1;
+    alignas(cmsghdr) std::array<char, CMSG_SPACE(sizeof(int) * (kHandoffMaxFds + 1))> ctrl{};
+    msg.msg_control    = ctrl.data();
+    msg.msg_controllen = ctrl.size();
+
+    ssize_t n;
+    do { n = ::recvmsg(sock, &msg, MSG_CMSG_CLOEXEC | MSG_WAITALL); } while (n < 0 && errno == EINTR);
+    for (cmsghdr* c = CMSG_FIRSTHDR(&msg); c; c = CMSG_NXTHDR(&msg, c)) {
+        if (c->cmsg_level != SOL_SOCKET || c->cmsg_type != SCM_RIGHTS) continue;
+        const std::size_t count = std::min((c->cmsg_len - CMSG_LEN(0)) / sizeof(int), fds.size() - nfds);
+        std::memcpy(fds.data() + nfds, CMSG_DATA(c), count * sizeof(int));
+        nfds += count;
+    }
+    const bool ok = (n == static_cast<ssize_t>(sizeof(m))) && m.magic == kMsgMagic &&
+                    (msg.msg_flags & MSG_CTRUNC) == 0;
+    if (!ok) close_all(fds, nfds);
+    return ok;
+}
+
+} // namespace
+
+// ---------------- HandoffRegion ----------------
+
+HandoffRegion::~HandoffRegion() { reset(); }
+
+HandoffRegion::HandoffRegion(HandoffRegion&& other) noexcept
+    : fd_(std::exchange(other.fd_, -1)),
+      base_(std::exchange(other.base_, nullptr)),
+      size_(std::exchange(other.size_, 0)) {}
+
+HandoffRegion& HandoffRegion::operator=(HandoffRegion&& other) noexcept {
+    if (this != &other) {
+        reset();
+        fd_   = std::exchange(other.fd_, -1);
+        base_ = std::exchange(other.base_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+}
+
+void HandoffRegion::reset() noexcept {
+    if (base_) ::munmap(base_, size_);
+    if (fd_ >= 0) ::close(fd_);
+    fd_ = -1; base_ = nullptr; size_ = 0;
+}
+
+alpha_detail::expected<HandoffRegion, HandoffError> HandoffRegion::create(std::size_t bytes) {
+    const auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    // Header + payload + worst-case alignment padding for every section.
+    const std::size_t size = align_up(align_up(sizeof(RegionHeader), kAlign) + bytes +
+                                      kHandoffMaxSections * kAlign, page);
+
+    HandoffRegion r;
+    r.fd_ = ::memfd_create("alpha-handoff", MFD_CLOEXEC);
+    if (r.fd_ < 0) return sys_error();
+    if (::ftruncate(r.fd_, static_cast<off_t>(size)) != 0) return sys_error();
+    void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, r.fd_, 0);
+    if (p == MAP_FAILED) return sys_error();
+    r.base_ = p;
+    r.size_ = size;
+
+    // memfd pages are zero-filled: only the header needs explicit values.
+    auto* h = header_of(p);
+    h->layout_version = kHandoffLayoutVersion;
+    h->used           = align_up(sizeof(RegionHeader), kAlign);
+    h->capacity       = size;
+    h->magic          = kRegionMagic;
+    return r;
+}
+
+alpha_detail::expected<HandoffRegion, HandoffError> HandoffRegion::attach(int fd) {
+    HandoffRegion r;
+    r.fd_ = fd;
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) return sys_error();
+    const auto size = static_cast<std::size_t>(st.st_size);
+    if (size < sizeof(RegionHeader)) return alpha_detail::unexpected(HandoffError::LayoutMismatch);
+    void* p = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED) return sys_error();
+    r.base_ = p;
+    r.size_ = size;
+
+    const auto* h = header_of(p);
+    if (h->magic != kRegionMagic || h->layout_version != kHandoffLayoutVersion ||
+        h->capacity != size || h->used > size || h->section_count > kHandoffMaxSections) {
+        return alpha_detail::unexpected(HandoffError::LayoutMismatch);
+    }
+    return r;
+}
+
+alpha_detail::expected<std::span<std::byte>, HandoffError>
+HandoffRegion::allocate(std::uint32_t kind, std::uint32_t index, std::size_t bytes) noexcept {
+    if (!base_) return alpha_detail::unexpected(HandoffError::NotFound);
+    auto* h = header_of(base_);
+    if (find(kind, index)) return alpha_detail::unexpected(HandoffError::Protocol); // duplicate
+    if (h->section_count >= kHandoffMaxSections || bytes > size_ - h->used) {
+        return alpha_detail::unexpected(HandoffError::RegionFull);
+    }
+    const auto offset = static_cast<std::size_t>(h->used);
+    h->sections[h->section_count++] = SectionDesc{kind, index, offset, bytes};
+    h->used = std::min<std::uint64_t>(align_up(offset + bytes, kAlign), size_);
+    return std::span<std::byte>(static_cast<std::byte*>(base_) + offset, bytes);
+}
+
+alpha_detail::expected<std::span<std::byte>, HandoffError>
+HandoffRegion::find(std::uint32_t kind, std::uint32_t index) const noexcept {
+    if (!base_) return alpha_detail::unexpected(HandoffError::NotFound);
+    const auto* h = header_of(base_);
+    for (std::uint32_t i = 0; i < h->section_count; ++i) {
+        const auto& s = h->sections[i];
+        if (s.kind != kind || s.index != index) continue;
+        if (s.offset + s.bytes > size_) return alpha_detail::unexpected(HandoffError::LayoutMismatch);
+        return std::span<std::byte>(static_cast<std::byte*>(base_) + s.offset,
+                                    static_cast<std::size_t>(s.bytes));
+    }
+    return alpha_detail::unexpected(HandoffError::NotFound);
+}
+
+// ---------------- HandoffChannel ----------------
+
+HandoffChannel::~HandoffChannel() {
+    if (fd_ >= 0) ::close(fd_);
+}
+
+HandoffChannel& HandoffChannel::operator=(HandoffChannel&& other) noexcept {
+    if (this != &other) {
+        if (fd_ >= 0) ::close(fd_);
+        fd_ = std::exchange(other.fd_, -1);
+    }
+    return *this;
+}
+
+alpha_detail::expected<int, HandoffError> HandoffChannel::listen(const std::string& path) {
+    sockaddr_un addr{};
+    if (!fill_addr(path, addr)) return alpha_detail::unexpected(HandoffError::Protocol);
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) return sys_error();
+    ::unlink(path.c_str()); // stale socket from a previous generation
+    if (::bind(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(fd, 1) != 0) {
+        ::close(fd);
+        return sys_error();
+    }
+    return fd;
+}
+
+alpha_detail::expected<HandoffChannel, HandoffError> HandoffChannel::accept(int listen_fd) {
+    int fd;
+    do { fd = ::accept4(listen_fd, nullptr, nullptr, SOCK_CLOEXEC); } while (fd < 0 && errno == EINTR);
+    if (fd < 0) return sys_error();
+    return HandoffChannel(fd);
+}
+
+alpha_detail::expected<HandoffChannel, HandoffError> HandoffChannel::connect(const std::string& path) {
+    sockaddr_un addr{};
+    if (!fill_addr(path, addr)) return alpha_detail::unexpected(HandoffError::Protocol);
+    HandoffChannel ch(::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0));
+    if (ch.fd_ < 0) return sys_error();
+    if (::connect(ch.fd_, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) return sys_error();
+    return ch;
+}
+
+alpha_detail::expected<void, HandoffError>
+HandoffChannel::send_offer(const HandoffRegion& region, std::span<const HandoffFd> fds) noexcept {
+    if (fds.size() > kHandoffMaxFds || region.fd() < 0) return alpha_detail::unexpected(HandoffError::Protocol);
+    WireMsg m{};
+    m.op   = static_cast<std::uint32_t>(Op::Offer);
+    m.nfds = static_cast<std::uint32_t>(fds.size());
+    std::array<int, kHandoffMaxFds + 1> raw{};
+    raw[0] = region.fd();
+    for (std::size_t i = 0; i < fds.size(); ++i) {
+        m.roles[i]  = fds[i].role;
+        raw[i + 1]  = fds[i].fd;
+    }
+    if (!send_msg(fd_, m, std::span<const int>(raw.data(), fds.size() + 1))) return sys_error();
+    return {};
+}
+
+alpha_detail::expected<HandoffChannel::Offer, HandoffError> HandoffChannel::recv_offer() {
+    WireMsg m{};
+    FdArray raw{};
+    std::size_t n = 0;
+    if (!recv_msg(fd_, m, raw, n)) return alpha_detail::unexpected(HandoffError::Protocol);
+    if (m.op != static_cast<std::uint32_t>(Op::Offer) || m.nfds > kHandoffMaxFds || n != m.nfds + 1) {
+        close_all(raw, n);
+        return alpha_detail::unexpected(HandoffError::Protocol);
+    }
+    Offer o;
+    o.region_fd = raw[0];
+    o.fds.reserve(m.nfds);
+    for (std::uint32_t i = 0; i < m.nfds; ++i) o.fds.push_back(HandoffFd{m.roles[i], raw[i + 1]});
+    return o;
+}
+
+alpha_detail::expected<void, HandoffError> HandoffChannel::send(Op op) noexcept {
+    WireMsg m{};
+    m.op = static_cast<std::uint32_t>(op);
+    if (!send_msg(fd_, m, {})) return sys_error();
+    return {};
+}
+
+alpha_detail::expected<void, HandoffError> HandoffChannel::expect(Op op) noexcept {
+    WireMsg m{};
+    FdArray stray{};
+    std::size_t n = 0;
+    const bool ok = recv_msg(fd_, m, stray, n);
+    close_all(stray, n);
+    if (!ok || m.op != static_cast<std::uint32_t>(op)) return alpha_detail::unexpected(HandoffError::Protocol);
+    return {};
+}
+
+} // namespace alpha::os
+
+#endif
@@ -0,0 +1,103 @@
+#if !defined(__linux__)
+
+/**
+ * @file handoff_unsupported.cpp
+ * @brief Handoff stubs for targets without memfd/SCM_RIGHTS: every call reports Unsupported.
+ * @note No descriptor is ever opened here; descriptors passed in (attach(), HandoffChannel(int))
+ *       are left to the caller.
+ */
+#include "alpha/os/handoff.hpp"
+
+#include <utility>
+
+namespace alpha::os {
+
+namespace {
+
+alpha_detail::unexpected<HandoffError> unsupported() noexcept {
+    return alpha_detail::unexpected(HandoffError::Unsupported);
+}
+
+} // namespace
+
+// ---------------- HandoffRegion ----------------
+
+HandoffRegion::~HandoffRegion() { reset(); }
+
+HandoffRegion::HandoffRegion(HandoffRegion&& other) noexcept
+    : fd_(std::exchange(other.fd_, -1)),
+      base_(std::exchange(other.base_, nullptr)),
+      size_(std::exchange(other.size_, 0)) {}
+
+HandoffRegion& HandoffRegion::operator=(HandoffRegion&& other) noexcept {
+    if (this != &other) {
+        fd_   = std::exchange(other.fd_, -1);
+        base_ = std::exchange(other.base_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+}
+
+void HandoffRegion::reset() noexcept {
+    fd_ = -1; base_ = nullptr; size_ = 0;
+}
+
+alpha_detail::expected<HandoffRegion, HandoffError> HandoffRegion::create(std::size_t) {
+    return unsupported();
+}
+
+alpha_detail::expected<HandoffRegion, HandoffError> HandoffRegion::attach(int) {
+    return unsupported();
+}
+
+alpha_detail::expected<std::span<std::byte>, HandoffError>
+HandoffRegion::allocate(std::uint32_t, std::uint32_t, std::size_t) noexcept {
+    return unsupported();
+}
+
+alpha_detail::expected<std::span<std::byte>, HandoffError>
+HandoffRegion::find(std::uint32_t, std::uint32_t) const noexcept {
+    return unsupported();
+}
+
+// ---------------- HandoffChannel ----------------
+
+HandoffChannel::~HandoffChannel() = default;
+
+HandoffChannel& HandoffChannel::operator=(HandoffChannel&& other) noexcept {
+    if (this != &other) fd_ = std::exchange(other.fd_, -1);
+    return *this;
+}
+
+alpha_detail::expected<int, HandoffError> HandoffChannel::listen(const std::string&) {
+    return unsupported();
+}
+
+alpha_detail::expected<HandoffChannel, HandoffError> HandoffChannel::accept(int) {
+    return unsupported();
+}
+
+alpha_detail::expected<HandoffChannel, HandoffError> HandoffChannel::connect(const std::string&) {
+    return unsupported();
+}
+
+alpha_detail::expected<void, HandoffError>
+HandoffChannel::send_offer(const HandoffRegion&, std::span<const HandoffFd>) noexcept {
+    return unsupported();
+}
+
+alpha_detail::expected<HandoffChannel::Offer, HandoffError> HandoffChannel::recv_offer() {
+    return unsupported();
+}
+
+alpha_detail::expected<void, HandoffError> HandoffChannel::send(Op) noexcept {
+    return unsupported();
+}
+
+alpha_detail::expected<void, HandoffError> HandoffChannel::expect(Op) noexcept {
+    return unsupported();
+}
+
+} // namespace alpha::os
+
+#endif
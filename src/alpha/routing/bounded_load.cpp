@@ -0,0 +1,87 @@
+/**
+ * @file bounded_load.cpp
+ * @brief Ring walk and load cap for BoundedLoadPolicy.
+ */
+#include "alpha/routing/bounded_load.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+namespace alpha::routing {
+
+namespace {
+/// murmur3 finalizer: ring points and flow positions must not inherit the RSS low bits.
+constexpr std::uint32_t mix32(std::uint32_t x) noexcept {
+    x ^= x >> 16; x *= 0x85EBCA6Bu;
+    x ^= x >> 13; x *= 0xC2B2AE35u;
+    return x ^ (x >> 16);
+}
+
+/// Clockwise distance from @p pos to the nearest ring point of path @p id.
+std::uint32_t ring_distance(PathId id, std::uint32_t pos) noexcept {
+    std::uint32_t best = std::numeric_limits<std::uint32_t>::max();
+    for (std::uint32_t r = 0; r < BoundedLoadPolicy::kReplicas; ++r) {
+        const std::uint32_t point = mix32(id * BoundedLoadPolicy::kReplicas + r + 0x9E3779B9u);
+        best = std::min(best, point - pos);  // unsigned wrap = clockwise distance
+    }
+    return best;
+}
+} // namespace
+
+BoundedLoadPolicy::BoundedLoadPolicy(const FlowTable& flows, BoundedLoadConfig cfg) noexcept
+: flows_(&flows), cfg_(cfg) {}
+
+std::uint32_t BoundedLoadPolicy::cap(std::uint64_t flows, std::uint32_t paths) const noexcept {
+    if (paths == 0) return std::numeric_limits<std::uint32_t>::max();
+    constexpr std::uint64_t kPpm = 1'000'000;
+    const std::uint64_t num = (flows + 1) * (kPpm + cfg_.epsilon_ppm);
+    const std::uint64_t den = kPpm * paths;
+    const std::uint64_t c = (num + den - 1) / den;
+    return static_cast<std::uint32_t>(std::min<std::uint64_t>(c, std::numeric_limits<std::uint32_t>::max()));
+}
+
+PathId BoundedLoadPolicy::choose(std::span<const CandidateRef> cands, const PacketContext& pkt) noexcept {
+    const std::size_t n = std::min(cands.size(), kMaxCandidates);
+    if (n == 0) return 0;
+
+    const std::uint32_t pos = mix32(pkt.flow_hash);
+    std::uint32_t dist[kMaxCandidates];
+    std::uint32_t load[kMaxCandidates];
+    std::uint64_t eligible = 0;
+    PathMetrics m{};
+    for (std::size_t i = 0; i < n; ++i) {
+        dist[i] = ring_distance(cands[i].id, pos);
+        const bool ok = !cfg_.skip_unhealthy || (dp::load_metrics(*cands[i].slot, m) && m.healthy);
+        eligible |= std::uint64_t{ok} << i;
+    }
+    // Nothing healthy: keep the placement stable over all candidates.
+    if (eligible == 0) eligible = (n == 64) ? ~std::uint64_t{0} : (std::uint64_t{1} << n) - 1;
+
+    std::uint64_t total = 0;
+    for (std::uint64_t b = eligible; b != 0; b &= b - 1) {
+        const auto i = static_cast<std::size_t>(std::countr_zero(b));
+        load[i] = flows_->active_flows(cands[i].id);
+        total += load[i];
+    }
+    const std::uint32_t limit = cap(total, static_cast<std::uint32_t>(std::popcount(eligible)));
+
+    // Walk the ring: repeatedly take the nearest remaining path. Some path is below
+    // the cap (the least loaded is at most the average), so this ends within one lap.
+    for (bool owner = true; eligible != 0; owner = false) {
+        std::size_t next = 0;
+        std::uint32_t best = std::numeric_limits<std::uint32_t>::max();
+        for (std::uint64_t b = eligible; b != 0; b &= b - 1) {
+            const auto i = static_cast<std::size_t>(std::countr_zero(b));
+            if (dist[i] <= best) { best = dist[i]; next = i; }
+        }
+        if (load[next] < limit) {
+            spilled_ += owner ? 0u : 1u;
+            return cands[next].id;
+        }
+        eligible &= ~(std::uint64_t{1} << next);
+    }
+    return cands[0].id;  // unreachable while counters are consistent
+}
+
+} // namespace alpha::routing
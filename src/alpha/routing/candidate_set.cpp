@@ -0,0 +1,107 @@
+/**
+ * @file candidate_set.cpp
+ * @brief Candidate array layout and PoP → PathId assignment.
+ */
+#include "alpha/routing/candidate_set.hpp"
+
+#include <algorithm>
+#include <new>
+#include <unordered_set>
+
+namespace alpha::routing {
+
+void CandidateSet::FreeLines::operator()(CandidateRef* p) const noexcept {
+    ::operator delete[](p, std::align_val_t{ALPHA_CACHELINE});
+}
+
+void CandidateSet::layout(const MetricsTable& table) {
+    stride_ = path_ids_.size();
+    const std::size_t n = stride_ * MetricsTable::kBuffers;
+    if (n == 0) return;
+    auto* mem = static_cast<CandidateRef*>(
+        ::operator new[](n * sizeof(CandidateRef), std::align_val_t{ALPHA_CACHELINE}));
+    refs_.reset(mem);
+    // One copy per metrics buffer: the slot pointer is the only difference.
+    for (std::size_t b = 0; b < MetricsTable::kBuffers; ++b) {
+        const MetricsSlot* slots = table.slots(b);
+        for (std::size_t i = 0; i < stride_; ++i) {
+            const PathId id = path_ids_[i];
+            ::new (mem + b * stride_ + i)
+                CandidateRef{id, id == kInvalidPath ? nullptr : slots + id};
+        }
+    }
+}
+
+CandidateCompiler::CandidateCompiler(const MetricsTable& table)
+    : table_(table),
+      current_(CandidateSet::compile(ServiceIndex::compile(nullptr, 0), table,
+                                     [](std::string_view) { return kInvalidPath; })) {}
+
+PathId CandidateCompiler::intern(const std::string& pop_id) {
+    if (auto it = paths_.find(pop_id); it != paths_.end()) return it->second;
+    PathId id = kInvalidPath;
+    if (!free_.empty()) {
+        id = free_.back();
+        free_.pop_back();
+    } else if (next_ < table_.size()) {
+        id = next_++;
+    } else {
+        ++overflow_;
+        return kInvalidPath;
+    }
+    paths_.emplace(pop_id, id);
+    return id;
+}
+
+PathId CandidateCompiler::path_of(std::string_view pop_id) const {
+    const auto it = paths_.find(pop_id);
+    return it == paths_.end() ? kInvalidPath : it->second;
+}
+
+void CandidateCompiler::reclaim() {
+    std::erase_if(replaced_, [](const Replaced& r) { return r.set.expired(); });
+    // A PathId dropped at version v is referenced only by sets older than v.
+    std::uint64_t oldest = current_->version();
+    for (const Replaced& r : replaced_) oldest = std::min(oldest, r.version);
+    // The reset must be in a published buffer: the epoch moved past the hand-out.
+    const std::uint64_t epoch = table_.epoch();
+    std::erase_if(retiring_, [&](const Retiring& r) {
+        if (r.version > oldest || r.reset_epoch == kNotReset || r.reset_epoch >= epoch) return false;
+        free_.push_back(r.id);
+        return true;
+    });
+}
+
+void CandidateCompiler::reset_updates(std::vector<PathUpdate>& out) {
+    for (Retiring& r : retiring_) {
+        if (r.reset_epoch != kNotReset) continue;
+        out.push_back(PathUpdate{r.id, PathMetrics{}});
+        r.reset_epoch = table_.epoch();
+    }
+}
+
+void CandidateCompiler::retire_absent(const ServiceIndex& next) {
+    std::unordered_set<std::string_view> listed;
+    for (ServiceHandle h = 0; h < next.size(); ++h)
+        for (const Pop& p : next.pops(h)) listed.insert(p.id);
+    for (auto it = paths_.begin(); it != paths_.end();) {
+        if (listed.count(it->first)) { ++it; continue; }
+        retiring_.push_back(Retiring{it->second, next.version()});
+        it = paths_.erase(it);
+    }
+}
+
+bool CandidateCompiler::refresh(const ServiceRegistry& reg) {
+    // Single control-plane writer: current_ can be read without the atomic load.
+    if (reg.version() == current_->version()) return false;
+    reclaim();
+    auto idx = ServiceIndex::compile(reg);
+    retire_absent(*idx);
+    auto next = CandidateSet::compile(std::move(idx), table_,
+                                      [this](const std::string& pop_id) { return intern(pop_id); });
+    replaced_.push_back(Replaced{current_, current_->version()});
+    std::atomic_store_explicit(&current_, std::move(next), std::memory_order_release);
+    return true;
+}
+
+} // namespace alpha::routing
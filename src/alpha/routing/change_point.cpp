@@ -0,0 +1,105 @@
+/**
+ * @file change_point.cpp
+ * @brief Two-sided CUSUM / Page-Hinkley steps, per-path banks and event → service fan-out.
+ */
+#include "alpha/routing/change_point.hpp"
+
+#include <algorithm>
+
+namespace alpha::routing {
+
+ChangeDetectorBank::ChangeDetectorBank(std::size_t paths, ChangeDetectorConfig rtt, ChangeDetectorConfig loss)
+: cfg_{rtt, loss}, state_(paths * kPathMetricCount) {}
+
+bool ChangeDetectorBank::step(State& s, const ChangeDetectorConfig& c, float x, bool& increase) const noexcept {
+    if (s.n < c.warmup) {   // seed the reference with the plain mean
+        ++s.n;
+        s.ref += (x - s.ref) / static_cast<float>(s.n);
+        return false;
+    }
+
+    bool up = false, down = false;
+    if (c.method == ChangeMethod::Cusum) {
+        const float z = (x - s.ref) / std::max({s.ref, c.floor, 1e-6f});
+        s.up   = std::max(0.0f, s.up + z - c.drift);
+        s.down = std::max(0.0f, s.down - z - c.drift);
+        if (s.up == 0.0f && s.down == 0.0f) s.ref += c.baseline_alpha * (x - s.ref);  // in control: track slowly
+        up   = s.up > c.threshold;
+        down = s.down > c.threshold;
+    } else {
+        ++s.n;
+        const float before = s.ref;
+        s.ref += (x - s.ref) / static_cast<float>(s.n);
+        const float z = (x - s.ref) / std::max({before, c.floor, 1e-6f});
+        s.up      += z - c.drift;
+        s.down    += -z - c.drift;
+        s.up_min   = std::min(s.up_min, s.up);
+        s.down_min = std::min(s.down_min, s.down);
+        up   = s.up - s.up_min > c.threshold;
+        down = s.down - s.down_min > c.threshold;
+    }
+    if (!up && !down) return false;
+
+    // Re-baseline on the new level; the shift is reported once.
+    increase = up;
+    s = State{};
+    s.ref = x;
+    s.n   = 1;
+    return true;
+}
+
+std::size_t ChangeDetectorBank::update(std::uint32_t path, float rtt_us, float loss, std::vector<ChangeEvent>& out) {
+    if (path >= size()) return 0;
+    std::size_t fired = 0;
+    const float x[kPathMetricCount] = {rtt_us, loss};
+    for (std::size_t m = 0; m < kPathMetricCount; ++m) {
+        const auto metric = static_cast<PathMetric>(m);
+        State& s = at(path, metric);
+        const float ref = s.ref;
+        bool increase = false;
+        if (!step(s, cfg_[m], x[m], increase)) continue;
+        out.push_back({path, metric, increase, ref, x[m]});
+        ++fired;
+    }
+    return fired;
+}
+
+std::size_t ChangeDetectorBank::update(std::span<const float> rtt_us, std::span<const float> loss,
+                                       std::vector<ChangeEvent>& out) {
+    const std::size_t n = std::min({size(), rtt_us.size(), loss.size()});
+    std::size_t fired = 0;
+    for (std::size_t p = 0; p < n; ++p) fired += update(static_cast<std::uint32_t>(p), rtt_us[p], loss[p], out);
+    return fired;
+}
+
+void ChangeDetectorBank::reset(std::uint32_t path) noexcept {
+    if (path >= size()) return;
+    for (std::size_t m = 0; m < kPathMetricCount; ++m) at(path, static_cast<PathMetric>(m)) = State{};
+}
+
+void PathSubscribers::subscribe(std::uint32_t path, ServiceHandle h) {
+    if (path >= by_path_.size() || h == kInvalidService) return;
+    auto& subs = by_path_[path];
+    if (std::find(subs.begin(), subs.end(), h) == subs.end()) subs.push_back(h);
+    if (h >= seen_.size()) seen_.resize(std::size_t{h} + 1, 0);
+}
+
+void PathSubscribers::clear() noexcept {
+    for (auto& subs : by_path_) subs.clear();
+}
+
+std::size_t PathSubscribers::affected(std::span<const ChangeEvent> events, std::vector<ServiceHandle>& out) {
+    const std::size_t before = out.size();
+    ++pass_;
+    for (const ChangeEvent& e : events) {
+        if (e.path >= by_path_.size()) continue;
+        for (const ServiceHandle h : by_path_[e.path]) {
+            if (seen_[h] == pass_) continue;
+            seen_[h] = pass_;
+            out.push_back(h);
+        }
+    }
+    return out.size() - before;
+}
+
+} // namespace alpha::routing
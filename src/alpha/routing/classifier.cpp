@@ -0,0 +1,225 @@
+/**
+ * @file classifier.cpp
+ * @brief Tuple-space compilation and priority-pruned (burst) lookups.
+ */
+#include "alpha/routing/classifier.hpp"
+#include "alpha/mem/prefetch.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <map>
+#include <utility>
+
+namespace alpha::routing {
+
+namespace {
+
+constexpr std::uint32_t prefix_mask32(std::uint8_t len) noexcept {
+    return len == 0 ? 0u : ~std::uint32_t{0} << (32 - len);
+}
+
+constexpr std::uint64_t pair_mask(std::uint8_t src_len, std::uint8_t dst_len) noexcept {
+    return (std::uint64_t{prefix_mask32(src_len)} << 32) | prefix_mask32(dst_len);
+}
+
+constexpr std::uint32_t kExtraPort  = 0x0000FFFFu;
+constexpr std::uint32_t kExtraProto = 0x00FF0000u;
+
+/// Hash fields of a tuple under construction.
+struct Shape {
+    std::uint8_t  src_len{0}, dst_len{0};
+    std::uint32_t extra{0};   ///< kExtraPort / kExtraProto
+
+    bool operator==(const Shape&) const = default;
+};
+
+/// Hash bits a shape uses (the tie-break when several tuples can take a rule).
+constexpr int specificity(const Shape& sh) noexcept {
+    return sh.src_len + sh.dst_len + std::popcount(sh.extra);
+}
+
+/// Rules assigned to one tuple, grouped by hash key (in rule order).
+struct Build {
+    Shape                                                                         shape;
+    std::map<std::pair<std::uint64_t, std::uint32_t>, std::vector<std::uint32_t>> keys;
+};
+
+/// What compile() needs of a rule to place it.
+struct Placement {
+    std::uint64_t addr{0};                 ///< Masked by the rule's own prefixes
+    std::uint8_t  src_len{0}, dst_len{0};
+    std::uint32_t exact{0};                ///< Hashable extras: kExtraPort if one dst port, kExtraProto if one protocol
+    std::uint32_t extra{0};                ///< dst port | protocol << 16
+
+    bool fits(const Shape& sh) const noexcept {
+        return sh.src_len <= src_len && sh.dst_len <= dst_len && (sh.extra & ~exact) == 0;
+    }
+    std::pair<std::uint64_t, std::uint32_t> key(const Shape& sh) const noexcept {
+        return {addr & pair_mask(sh.src_len, sh.dst_len), extra & sh.extra};
+    }
+    /// Most specific tuple the rule can live in.
+    Shape finest() const noexcept { return {src_len, dst_len, exact}; }
+};
+
+Build* find_shape(std::vector<Build>& builds, const Shape& sh) noexcept {
+    const auto it = std::find_if(builds.begin(), builds.end(), [&](const Build& b) { return b.shape == sh; });
+    return it == builds.end() ? nullptr : &*it;
+}
+
+std::size_t run_size(const Build& b, const std::pair<std::uint64_t, std::uint32_t>& k) {
+    const auto it = b.keys.find(k);
+    return it == b.keys.end() ? 0 : it->second.size();
+}
+
+} // namespace
+
+std::uint32_t Classifier::Tuple::probe(std::uint64_t a, std::uint64_t h, const ClassifierKey& k) const noexcept {
+    if (!may_hold(h)) return kNoRule;
+    for (std::size_t i = static_cast<std::size_t>(h) & slot_mask;; i = (i + 1) & slot_mask) {
+        const Entry& e = slots[i];
+        if (e.rule == kNoRule) return kNoRule;
+        if (e.matches(a, k)) return e.rule;
+    }
+}
+
+alpha_detail::expected<std::shared_ptr<const Classifier>, ClassifierError>
+Classifier::compile(std::span<const ClassifierRule> rules, ClassAction miss) {
+    if (rules.size() > kClassifierMaxRules) return alpha_detail::unexpected(ClassifierError::TooManyRules);
+
+    std::shared_ptr<Classifier> c(new Classifier());
+    c->miss_ = miss;
+    c->actions_.reserve(rules.size());
+
+    std::vector<Entry> entries;
+    std::vector<Placement> placed;
+    entries.reserve(rules.size());
+    placed.reserve(rules.size());
+    std::vector<Build> builds;
+    for (std::uint32_t r = 0; r < rules.size(); ++r) {
+        const ClassifierRule& x = rules[r];
+        if (x.src_len > 32 || x.dst_len > 32) return alpha_detail::unexpected(ClassifierError::BadPrefix);
+        if (x.src_port_lo > x.src_port_hi || x.dst_port_lo > x.dst_port_hi)
+            return alpha_detail::unexpected(ClassifierError::BadRange);
+        if (!x.any_dscp && x.dscp > 63) return alpha_detail::unexpected(ClassifierError::BadDscp);
+        c->actions_.push_back(x.action);
+
+        Entry e{};
+        e.amask      = pair_mask(x.src_len, x.dst_len);
+        e.addr       = ((std::uint64_t{x.src_ip} << 32) | x.dst_ip) & e.amask;
+        e.rule       = r;
+        e.sport_lo   = x.src_port_lo; e.sport_hi = x.src_port_hi;
+        e.dport_lo   = x.dst_port_lo; e.dport_hi = x.dst_port_hi;
+        e.proto      = x.proto; e.proto_mask = x.any_proto ? 0 : 0xFF;
+        e.dscp       = x.dscp;  e.dscp_mask  = x.any_dscp ? 0 : 0xFF;
+        entries.push_back(e);
+
+        Placement& pl = placed.emplace_back();
+        pl.addr    = e.addr;
+        pl.src_len = x.src_len;
+        pl.dst_len = x.dst_len;
+        pl.exact   = (x.dst_port_lo == x.dst_port_hi ? kExtraPort : 0u) | (x.any_proto ? 0u : kExtraProto);
+        pl.extra   = std::uint32_t{x.dst_port_lo} | std::uint32_t{x.proto} << 16;
+
+        // Most specific tuple that fits and has room: more hash bits, shorter chains.
+        Build* home = nullptr;
+        for (Build& b : builds) {
+            if (!pl.fits(b.shape) || (home && specificity(b.shape) <= specificity(home->shape))) continue;
+            if (run_size(b, pl.key(b.shape)) < kClassifierChainCap) home = &b;
+        }
+        if (!home) {
+            // Relaxation ladder: the first shape not built yet; once all are built, the
+            // rule joins its most specific tuple, full or not.
+            const std::uint8_t s8 = static_cast<std::uint8_t>(x.src_len & ~7u);
+            const std::uint8_t d8 = static_cast<std::uint8_t>(x.dst_len & ~7u);
+            for (const Shape& sh : {Shape{0, d8, 0}, Shape{s8, d8, 0}, pl.finest()}) {
+                home = find_shape(builds, sh);
+                if (!home) { home = &builds.emplace_back(Build{sh, {}}); break; }
+            }
+        }
+        home->keys[pl.key(home->shape)].push_back(r);
+    }
+
+    c->tuples_.reserve(builds.size());
+    for (const Build& b : builds) {
+        Tuple t;
+        t.mask       = pair_mask(b.shape.src_len, b.shape.dst_len);
+        t.extra_mask = b.shape.extra;
+        std::size_t n = 0;
+        for (const auto& kv : b.keys) {
+            if (kv.second.empty()) continue;
+            n += kv.second.size();
+            t.best_rule   = std::min(t.best_rule, kv.second.front());
+            c->max_chain_ = std::max(c->max_chain_, kv.second.size());
+        }
+        if (n == 0) continue;
+        // Load factor <= 1/2. Keys are inserted run by run, rules in order within a run,
+        // so each key's entries appear along its probe chain in rule order.
+        const std::size_t cap = std::bit_ceil(std::max<std::size_t>(n * 2, 8));
+        t.slots.assign(cap, Entry{});
+        t.slot_mask = cap - 1;
+        t.homes.assign((cap + 63) / 64, 0);
+        for (const auto& [k, run] : b.keys) {
+            const std::size_t home = static_cast<std::size_t>(t.hash_of(k.first, k.second));
+            t.homes[(home & t.slot_mask) >> 6] |= std::uint64_t{1} << (home & 63);
+            for (const std::uint32_t r : run) {
+                std::size_t i = home & t.slot_mask;
+                while (t.slots[i].rule != kNoRule) i = (i + 1) & t.slot_mask;
+                t.slots[i] = entries[r];
+            }
+        }
+        c->tuples_.push_back(std::move(t));
+    }
+    std::sort(c->tuples_.begin(), c->tuples_.end(),
+              [](const Tuple& x, const Tuple& y) { return x.best_rule < y.best_rule; });
+    return std::shared_ptr<const Classifier>(std::move(c));
+}
+
+std::uint32_t Classifier::match(const ClassifierKey& k) const noexcept {
+    const std::uint64_t a = addr_of(k);
+    const std::uint32_t x = extra_of(k);
+    std::uint32_t best = kNoRule;
+    for (const Tuple& t : tuples_) {
+        if (t.best_rule >= best) break;  // sorted: no later tuple can win
+        const std::uint32_t r = t.probe(a, t.hash_of(a, x), k);
+        if (r < best) best = r;
+    }
+    return best;
+}
+
+void Classifier::classify_burst(std::span<const ClassifierKey> keys, std::span<ClassAction> out) const noexcept {
+    // Software pipeline: the chain heads of key i + kBurstGroup in the first kBurstTuples
+    // tuples (the ones every lookup starts with) are hashed and prefetched while key i is
+    // matched, so their misses overlap with useful work.
+    constexpr std::size_t D = kBurstGroup;
+    const std::size_t nt = std::min(kBurstTuples, tuples_.size());
+    std::uint64_t hs[D][kBurstTuples];
+    const auto stage = [&](std::size_t i) noexcept {
+        const std::uint64_t a = addr_of(keys[i]);
+        const std::uint32_t x = extra_of(keys[i]);
+        for (std::size_t t = 0; t < nt; ++t) {
+            const std::uint64_t h = tuples_[t].hash_of(a, x);
+            hs[i % D][t] = h;
+            if (tuples_[t].may_hold(h)) alpha::mem::prefetch_read(&tuples_[t].slot_of(h));
+        }
+    };
+
+    const std::size_t n = keys.size();
+    for (std::size_t i = 0; i < std::min(D, n); ++i) stage(i);
+    for (std::size_t i = 0; i < n; ++i) {
+        const ClassifierKey& k = keys[i];
+        const std::uint64_t a = addr_of(k);
+        const std::uint32_t x = extra_of(k);
+        std::uint32_t best = kNoRule;
+        for (std::size_t t = 0; t < tuples_.size(); ++t) {
+            const Tuple& tu = tuples_[t];
+            if (tu.best_rule >= best) break;
+            const std::uint64_t h = t < nt ? hs[i % D][t] : tu.hash_of(a, x);
+            const std::uint32_t r = tu.probe(a, h, k);
+            if (r < best) best = r;
+        }
+        if (i + D < n) stage(i + D);
+        out[i] = best == kNoRule ? miss_ : actions_[best];
+    }
+}
+
+} // namespace alpha::routing
@@ -0,0 +1,75 @@
+/**
+ * @file decision_table.cpp
+ * @brief Per-epoch build of the (service, class) decision table.
+ */
+#include "alpha/routing/decision_table.hpp"
+
+namespace alpha::routing {
+
+namespace {
+struct Pick {
+    PathId id{kInvalidPath};
+    bool   healthy{false};
+};
+
+// LatencyAwarePolicy::choose() without exploration, optionally ignoring one path.
+Pick pick_min_rtt(std::span<const CandidateRef> cands, std::uint8_t dscp,
+                  const LatencyAwareConfig& cfg, PathId skip) noexcept {
+    Pick best{}; PathMetrics bestm{}; PathMetrics m{};
+    for (const auto& c : cands) {
+        if (c.id == skip || !dp::load_metrics(*c.slot, m) || !m.healthy) continue;
+        if (!best.healthy || m.rtt_us < bestm.rtt_us) { best = {c.id, true}; bestm = m; }
+        else if (cfg.prefer_qos_class) {
+            const bool close = (m.rtt_us <= bestm.rtt_us + cfg.tie_margin_us);
+            if (close && qos_match(m.qos_class, dscp) && !qos_match(bestm.qos_class, dscp)) {
+                best = {c.id, true}; bestm = m;
+            }
+        }
+    }
+    if (best.healthy || skip != kInvalidPath || cands.empty()) return best;
+
+    // No healthy path: absolute min RTT, as the policy does.
+    bool init = false; best.id = cands[0].id;
+    for (const auto& c : cands) {
+        if (!dp::load_metrics(*c.slot, m)) continue;
+        if (!init || m.rtt_us < bestm.rtt_us) { best.id = c.id; bestm = m; init = true; }
+    }
+    return best;
+}
+} // namespace
+
+DecisionTable::DecisionTable(LatencyAwareConfig cfg, std::span<const std::uint8_t> class_dscp,
+                             std::size_t max_services)
+    : cfg_(cfg),
+      policy_(cfg),
+      classes_(class_dscp.size()),
+      max_services_(max_services),
+      class_dscp_(class_dscp.begin(), class_dscp.end()) {
+    for (auto& b : bufs_) b.d.reset(new Decision[max_services_ * classes_]());
+}
+
+bool DecisionTable::build(const CandidateSet& cs, const MetricsTable& metrics, std::uint64_t epoch) noexcept {
+    if (epoch > metrics.epoch()) return false; // not published yet
+    // Claim: one builder per epoch, never an older epoch after a newer one.
+    auto c = claimed_.load(std::memory_order_acquire);
+    do {
+        if (c >= epoch + 1) return false;
+    } while (!claimed_.compare_exchange_weak(c, epoch + 1, std::memory_order_acq_rel));
+
+    Buffer& b = bufs_[epoch % MetricsTable::kBuffers];
+    const std::size_t n = cs.index().size() < max_services_ ? cs.index().size() : max_services_;
+    for (ServiceHandle h = 0; h < n; ++h) {
+        const auto cands = cs.candidates(h, epoch);
+        for (std::size_t k = 0; k < classes_; ++k) {
+            Decision& d = b.d[h * classes_ + k];
+            d.best   = pick_min_rtt(cands, class_dscp_[k], cfg_, kInvalidPath).id;
+            d.backup = pick_min_rtt(cands, class_dscp_[k], cfg_, d.best).id;
+        }
+    }
+    b.version  = cs.version();
+    b.services = n;
+    b.epoch.store(epoch, std::memory_order_release);
+    return true;
+}
+
+} // namespace alpha::routing
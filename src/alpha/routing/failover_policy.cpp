@@ -17,6 +17,11 @@ HealthState FailoverPolicy::state_of(const std::string& id, const std::vector<Pa
     return HealthState::Down; // unknown → treat conservatively
 }
 
+SrlgMask FailoverPolicy::srlg_of(const std::string& id, const std::vector<PathHealth>& h) {
+    for (const auto& ph : h) if (ph.path_id == id) return ph.srlg;
+    return 0;
+}
+
 bool FailoverPolicy::allow_switch(std::chrono::steady_clock::time_point last,
                                   std::chrono::steady_clock::time_point now,
                                   uint32_t hold_ms) const noexcept {
@@ -46,8 +51,19 @@ FailoverPolicy::evaluate(const std::string& current,
     }
     if (!best) return std::nullopt; // nothing to do
 
-    // If current is Down → switch immediately to best healthy
+    // If current is Down → switch immediately to best healthy, preferring one that
+    // shares no risk group with current (whatever took current down likely hits those too)
     if (cur_state == HealthState::Down) {
+        const SrlgMask cur_srlg = cfg_.prefer_srlg_disjoint ? srlg_of(current, health) : 0;
+        if (cur_srlg & srlg_of(best->path_id, health)) {
+            const QoSScore* disjoint = nullptr;
+            for (const auto& s : scores) {
+                if (state_of(s.path_id, health) == HealthState::Down) continue;
+                if (cur_srlg & srlg_of(s.path_id, health)) continue;
+                if (!disjoint || s.score > disjoint->score) disjoint = &s;
+            }
+            if (disjoint) return FailoverDecision{disjoint->path_id, "current_down_srlg_disjoint"};
+        }
         return FailoverDecision{best->path_id, "current_down"};
     }
 
@@ -75,11 +91,41 @@ FailoverPolicy::evaluate(const std::string& current,
         if (prim && prim_state != HealthState::Down &&
             prim->score >= (best ? best->score : 0.0) &&
             allow_switch(prim_last_change, now, cfg_.recovery_hold_ms)) {
-            return FailoverDecision{cfg_.primary_path_id, "return_to_primary"};
+            return FailoverDecision{cfg_.primary_path_id, "return_to_primary", cfg_.return_step_ppm};
         }
     }
 
     return std::nullopt; // keep current
 }
 
+std::optional<FailoverDecision>
+FailoverPolicy::evaluate(const std::string& current,
+                         const std::vector<QoSScore>& scores,
+                         const std::vector<QoSScore>& predicted,
+                         const std::vector<PathHealth>& health,
+                         std::chrono::steady_clock::time_point now) const {
+    if (auto d = evaluate(current, scores, health, now)) return d;
+    if (!cfg_.preempt_on_forecast) return std::nullopt;
+
+    const QoSScore* cur = find_score(predicted, current);
+    if (!cur || cur->within_thresholds) return std::nullopt;
+
+    const QoSScore* best = nullptr;
+    for (const auto& s : predicted) {
+        if (s.path_id == current || !s.within_thresholds) continue;
+        if (state_of(s.path_id, health) == HealthState::Down) continue;
+        if (!best || s.score > best->score) best = &s;
+    }
+    // The predicted breach is the trigger, so no improvement margin: the target must just
+    // be compliant and predicted better; min_hold_ms still applies.
+    if (!best || best->score <= cur->score) return std::nullopt;
+
+    const auto cur_ph_it = std::find_if(health.begin(), health.end(),
+                                        [&](const PathHealth& p){ return p.path_id == current; });
+    const auto cur_last_change = (cur_ph_it == health.end()) ? std::chrono::steady_clock::time_point{}
+                                                             : cur_ph_it->last_change;
+    if (!allow_switch(cur_last_change, now, cfg_.min_hold_ms)) return std::nullopt;
+    return FailoverDecision{best->path_id, "predicted_degradation"};
+}
+
 } // namespace alpha::routing
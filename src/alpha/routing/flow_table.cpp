@@ -0,0 +1,149 @@
+/**
+ * @file flow_table.cpp
+ * @brief Implementation of the per-worker FlowTable.
+ */
+#include "alpha/routing/flow_table.hpp"
+#include "alpha/mem/prefetch.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+
+namespace alpha::routing {
+
+namespace {
+/// splitmix64 finalizer: spreads fingerprints before Fibonacci slot selection.
+inline std::uint64_t mix64(std::uint64_t x) noexcept {
+    x ^= x >> 30; x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27; x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+}
+
+FlowTable::FlowTable(std::size_t capacity_pow2) {
+    init_geometry(capacity_pow2);
+    owned_ = std::make_unique<FlowEntry[]>(capacity_pow2); // value-initialized: all empty
+    slots_ = owned_.get();
+}
+
+FlowTable::FlowTable(std::span<FlowEntry> storage, bool adopt) {
+    init_geometry(storage.size());
+    slots_ = storage.data();
+    if (!adopt) {
+        std::fill(storage.begin(), storage.end(), FlowEntry{});
+        return;
+    }
+    if (!can_adopt(storage)) std::abort(); // over the load cap: probes may never hit an empty slot
+    for (const auto& e : storage) size_ += (e.key != 0) ? 1u : 0u;
+}
+
+bool FlowTable::can_adopt(std::span<const FlowEntry> storage) noexcept {
+    const std::size_t n = storage.size();
+    if (n < 2 || !std::has_single_bit(n)) return false;
+    const auto used = static_cast<std::size_t>(
+        std::count_if(storage.begin(), storage.end(), [](const FlowEntry& e) { return e.key != 0; }));
+    return used <= n - n / 4;   // == max_size()
+}
+
+void FlowTable::init_geometry(std::size_t capacity_pow2) {
+    if (capacity_pow2 < 2 || !std::has_single_bit(capacity_pow2)) {
+        std::abort(); // RT bring-up: fail early on invalid sizing.
+    }
+    capacity_ = capacity_pow2;
+    mask_     = capacity_pow2 - 1;
+    shift_    = 64u - static_cast<unsigned>(std::countr_zero(capacity_pow2));
+}
+
+std::size_t FlowTable::home_of(std::uint64_t key) const noexcept {
+    return static_cast<std::size_t>((mix64(key) * 0x9E3779B97F4A7C15ULL) >> shift_);
+}
+
+const FlowEntry* FlowTable::find(std::uint64_t key) const noexcept {
+    if (key == 0) return nullptr;
+    for (std::size_t i = home_of(key);; i = (i + 1) & mask_) {
+        const FlowEntry& e = slots_[i];
+        if (e.key == key) return &e;
+        if (e.key == 0) return nullptr; // load cap guarantees an empty slot
+    }
+}
+
+void FlowTable::find_burst(std::span<const std::uint64_t> keys,
+                           std::span<const FlowEntry*> out) const noexcept {
+    std::size_t home[kPrefetchGroup];
+    for (std::size_t base = 0; base < keys.size(); base += kPrefetchGroup) {
+        const std::size_t n = std::min(kPrefetchGroup, keys.size() - base);
+        // Stage 1: hash everything and issue all prefetches.
+        for (std::size_t i = 0; i < n; ++i) {
+            home[i] = home_of(keys[base + i]);
+            alpha::mem::prefetch_read(&slots_[home[i]]);
+        }
+        // Stage 2: compare; the home lines are (mostly) in flight or resident.
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::uint64_t key = keys[base + i];
+            const FlowEntry* hit = nullptr;
+            if (key != 0) {
+                for (std::size_t j = home[i];; j = (j + 1) & mask_) {
+                    const FlowEntry& e = slots_[j];
+                    if (e.key == key) { hit = &e; break; }
+                    if (e.key == 0) break;
+                }
+            }
+            out[base + i] = hit;
+        }
+    }
+}
+
+bool FlowTable::insert(std::uint64_t key, std::uint32_t hash, PathId path) noexcept {
+    if (key == 0) return false;
+    for (std::size_t i = home_of(key);; i = (i + 1) & mask_) {
+        FlowEntry& e = slots_[i];
+        if (e.key == key) {
+            count_out(e.path);
+            count_in(path);
+            e.hash = hash; e.path = path;
+            return true;
+        }
+        if (e.key == 0) {
+            if (size_ >= max_size()) return false;
+            e = FlowEntry{key, hash, path};
+            count_in(path);
+            ++size_;
+            return true;
+        }
+    }
+}
+
+bool FlowTable::erase(std::uint64_t key) noexcept {
+    if (key == 0) return false;
+    for (std::size_t i = home_of(key);; i = (i + 1) & mask_) {
+        if (slots_[i].key == key) { remove_at(i); return true; }
+        if (slots_[i].key == 0) return false;
+    }
+}
+
+void FlowTable::track_paths(std::size_t paths) {
+    path_flows_    = std::make_unique<std::uint32_t[]>(paths); // zeroed
+    tracked_paths_ = paths;
+    for_each([this](const FlowEntry& e) { count_in(e.path); });
+}
+
+void FlowTable::remove_at(std::size_t i) noexcept {
+    // Backward-shift: pull later cluster members into the hole when their
+    // home slot does not lie cyclically in (hole, j].
+    count_out(slots_[i].path);
+    std::size_t hole = i;
+    for (std::size_t j = (hole + 1) & mask_; slots_[j].key != 0; j = (j + 1) & mask_) {
+        const std::size_t home = home_of(slots_[j].key);
+        const std::size_t dist_home = (j - home) & mask_;
+        const std::size_t dist_hole = (j - hole) & mask_;
+        if (dist_home >= dist_hole) {
+            slots_[hole] = slots_[j];
+            hole = j;
+        }
+    }
+    slots_[hole] = FlowEntry{};
+    --size_;
+}
+
+} // namespace alpha::routing
@@ -0,0 +1,90 @@
+/**
+ * @file forecast.cpp
+ * @brief Damped Holt updates and forecasts over structure-of-arrays path state.
+ */
+#include "alpha/routing/forecast.hpp"
+
+#include <algorithm>
+
+namespace alpha::routing {
+
+namespace {
+
+/**
+ * One damped-Holt step for n series. The first sample seeds the level (seen = 0 → 1)
+ * by blending rather than branching, so the loop stays vectorizable.
+ */
+void holt_step(float* __restrict level, float* __restrict trend, const float* __restrict seen,
+               const float* __restrict x, std::size_t n, float a, float b, float phi) noexcept {
+    for (std::size_t i = 0; i < n; ++i) {
+        const float l0 = level[i];
+        const float t0 = phi * trend[i];
+        const float l  = a * x[i] + (1.0f - a) * (l0 + t0);
+        const float t  = b * (l - l0) + (1.0f - b) * t0;
+        const float s  = seen[i];
+        level[i] = s * l + (1.0f - s) * x[i];
+        trend[i] = s * t;
+    }
+}
+
+void holt_predict(const float* __restrict level, const float* __restrict trend, std::size_t n, float k,
+                  float hi, float* __restrict out) noexcept {
+    for (std::size_t i = 0; i < n; ++i) out[i] = std::clamp(level[i] + k * trend[i], 0.0f, hi);
+}
+
+constexpr float kNoCeiling = 3.4e38f;
+
+} // namespace
+
+MetricForecaster::MetricForecaster(std::size_t paths, ForecastConfig cfg)
+: cfg_(cfg),
+  rtt_level_(paths, 0.0f), rtt_trend_(paths, 0.0f),
+  loss_level_(paths, 0.0f), loss_trend_(paths, 0.0f),
+  seen_(paths, 0.0f) {
+    cfg_.alpha = std::clamp(cfg_.alpha, 0.0f, 1.0f);
+    cfg_.beta  = std::clamp(cfg_.beta, 0.0f, 1.0f);
+    cfg_.phi   = std::clamp(cfg_.phi, 0.0f, 1.0f);
+}
+
+void MetricForecaster::update(std::span<const float> rtt_us, std::span<const float> loss) noexcept {
+    const std::size_t n = std::min({size(), rtt_us.size(), loss.size()});
+    holt_step(rtt_level_.data(), rtt_trend_.data(), seen_.data(), rtt_us.data(), n, cfg_.alpha, cfg_.beta, cfg_.phi);
+    holt_step(loss_level_.data(), loss_trend_.data(), seen_.data(), loss.data(), n, cfg_.alpha, cfg_.beta, cfg_.phi);
+    std::fill_n(seen_.begin(), n, 1.0f);
+}
+
+void MetricForecaster::update(std::size_t path, float rtt_us, float loss) noexcept {
+    if (path >= size()) return;
+    holt_step(&rtt_level_[path], &rtt_trend_[path], &seen_[path], &rtt_us, 1, cfg_.alpha, cfg_.beta, cfg_.phi);
+    holt_step(&loss_level_[path], &loss_trend_[path], &seen_[path], &loss, 1, cfg_.alpha, cfg_.beta, cfg_.phi);
+    seen_[path] = 1.0f;
+}
+
+float MetricForecaster::damped(std::uint32_t horizon) const noexcept {
+    const float phi = cfg_.phi;
+    if (phi >= 1.0f) return static_cast<float>(horizon);
+    float k = 0.0f, p = 1.0f;
+    for (std::uint32_t h = 0; h < horizon && p > 1e-6f; ++h) {
+        p *= phi;
+        k += p;
+    }
+    return k;
+}
+
+float MetricForecaster::rtt_us(std::size_t path, std::uint32_t horizon) const noexcept {
+    if (path >= size()) return 0.0f;
+    return std::max(rtt_level_[path] + damped(horizon) * rtt_trend_[path], 0.0f);
+}
+
+float MetricForecaster::loss(std::size_t path, std::uint32_t horizon) const noexcept {
+    if (path >= size()) return 0.0f;
+    return std::clamp(loss_level_[path] + damped(horizon) * loss_trend_[path], 0.0f, 1.0f);
+}
+
+void MetricForecaster::predict(std::uint32_t horizon, std::span<float> rtt_out, std::span<float> loss_out) const noexcept {
+    const float k = damped(horizon);
+    holt_predict(rtt_level_.data(), rtt_trend_.data(), std::min(size(), rtt_out.size()), k, kNoCeiling, rtt_out.data());
+    holt_predict(loss_level_.data(), loss_trend_.data(), std::min(size(), loss_out.size()), k, 1.0f, loss_out.data());
+}
+
+} // namespace alpha::routing
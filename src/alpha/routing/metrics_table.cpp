@@ -0,0 +1,41 @@
+/**
+ * @file metrics_table.cpp
+ * @brief Tick publication and buffer reclamation for MetricsTable.
+ */
+#include "alpha/routing/metrics_table.hpp"
+
+namespace alpha::routing {
+
+MetricsTable::MetricsTable(std::size_t paths, std::size_t readers)
+    : paths_(paths),
+      readers_(readers),
+      buf_(new MetricsSlot[kBuffers * paths]()),
+      announce_(new Announce[readers]()) {}
+
+bool MetricsTable::reclaimable(std::uint64_t epoch) const noexcept {
+    // Buffer epoch % kBuffers last held epoch - kBuffers; readers at or below it block reuse.
+    if (epoch < kBuffers) return true;
+    const std::uint64_t last_user = epoch - kBuffers;
+    for (std::size_t r = 0; r < readers_; ++r) {
+        if (announce_[r].v.load(std::memory_order_seq_cst) <= last_user) return false;
+    }
+    return true;
+}
+
+bool MetricsTable::publish(std::span<const PathUpdate> updates) noexcept {
+    const std::uint64_t cur  = epoch_.load(std::memory_order_relaxed); // single writer
+    const std::uint64_t next = cur + 1;
+    if (!reclaimable(next)) { ++stalled_; return false; }
+
+    const MetricsSlot* src = slots(cur);
+    MetricsSlot*       dst = buf_.get() + (next % kBuffers) * paths_;
+    // Plain copies: no reader can see dst until the epoch store below.
+    for (std::size_t i = 0; i < paths_; ++i) dst[i].metrics = src[i].metrics;
+    for (const auto& u : updates) {
+        if (u.id < paths_) dst[u.id].metrics = u.metrics;
+    }
+    epoch_.store(next, std::memory_order_seq_cst); // the tick's single publication point
+    return true;
+}
+
+} // namespace alpha::routing
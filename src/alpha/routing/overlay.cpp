@@ -0,0 +1,233 @@
+/**
+ * @file overlay.cpp
+ * @brief Min-plus relay computation, route composition and relay candidate updates.
+ */
+#include "alpha/routing/overlay.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace alpha::routing {
+
+namespace {
+
+/// Unreachable cost; two of them still add up without overflowing int32.
+constexpr std::int32_t kInf = 0x3FFFFFFF;
+
+constexpr std::uint64_t kPpm = 1'000'000;
+
+// Runtime dispatch of the min-plus kernel to the widest vector unit (ifunc; x86-64 Linux).
+#if defined(__x86_64__) && defined(__linux__) && defined(__GNUC__)
+#define ALPHA_MINPLUS_CLONES __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define ALPHA_MINPLUS_CLONES
+#endif
+
+/**
+ * out[j] = min_k a[k] + b[k][j], arg[j] = the minimizing k (first on ties).
+ * Branch-free inner loop over a contiguous row: compiles to vector add/compare/blend.
+ */
+ALPHA_MINPLUS_CLONES
+void min_plus_row(const std::int32_t* __restrict a, const std::int32_t* __restrict b, std::size_t n,
+                  std::int32_t* __restrict out, std::uint32_t* __restrict arg) noexcept {
+    std::fill(out, out + n, kInf);
+    std::fill(arg, arg + n, std::uint32_t{kNoRelay});
+    for (std::size_t k = 0; k < n; ++k) {
+        const std::int32_t ak = a[k];
+        if (ak >= kInf) continue;
+        const std::int32_t* __restrict row = b + k * n;
+        const auto kk = static_cast<std::uint32_t>(k);
+        for (std::size_t j = 0; j < n; ++j) {
+            const std::int32_t c = ak + row[j];
+            const bool lt = c < out[j];
+            out[j] = lt ? c : out[j];
+            arg[j] = lt ? kk : arg[j];
+        }
+    }
+}
+
+/// As min_plus_row, plus the runner-up over a different k in out2/arg2 (kInf/kNoRelay if none).
+ALPHA_MINPLUS_CLONES
+void min_plus_row2(const std::int32_t* __restrict a, const std::int32_t* __restrict b, std::size_t n,
+                   std::int32_t* __restrict out, std::uint32_t* __restrict arg,
+                   std::int32_t* __restrict out2, std::uint32_t* __restrict arg2) noexcept {
+    std::fill(out, out + n, kInf);
+    std::fill(arg, arg + n, std::uint32_t{kNoRelay});
+    std::fill(out2, out2 + n, kInf);
+    std::fill(arg2, arg2 + n, std::uint32_t{kNoRelay});
+    for (std::size_t k = 0; k < n; ++k) {
+        const std::int32_t ak = a[k];
+        if (ak >= kInf) continue;
+        const std::int32_t* __restrict row = b + k * n;
+        const auto kk = static_cast<std::uint32_t>(k);
+        for (std::size_t j = 0; j < n; ++j) {
+            const std::int32_t c = ak + row[j];
+            const bool lt  = c < out[j];
+            const bool lt2 = c < out2[j];
+            out2[j] = lt ? out[j] : (lt2 ? c : out2[j]);
+            arg2[j] = lt ? arg[j] : (lt2 ? kk : arg2[j]);
+            out[j]  = lt ? c : out[j];
+            arg[j]  = lt ? kk : arg[j];
+        }
+    }
+}
+
+} // namespace
+
+OverlayMatrix::OverlayMatrix(std::size_t pops)
+: n_(std::min(pops, kOverlayMaxPops)), rtt_(n_ * n_, kDown), loss_(n_ * n_, static_cast<std::uint32_t>(kPpm)) {}
+
+std::shared_ptr<const OverlayTable>
+OverlayTable::compute(const OverlayMatrix& m, std::span<const OverlayClass> classes) {
+    return build(m, classes, 0);
+}
+
+std::shared_ptr<OverlayTable>
+OverlayTable::build(const OverlayMatrix& m, std::span<const OverlayClass> classes, std::uint64_t generation) {
+    std::shared_ptr<OverlayTable> t(new OverlayTable());
+    const std::size_t n = m.size();
+    t->n_ = n;
+    t->generation_ = generation;
+    t->classes_.assign(classes.begin(), classes.end());
+    t->rtt_.resize(n * n);
+    t->loss_.resize(n * n);
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            t->rtt_[i * n + j]  = m.rtt_us(static_cast<PopIndex>(i), static_cast<PopIndex>(j));
+            t->loss_[i * n + j] = m.loss_ppm(static_cast<PopIndex>(i), static_cast<PopIndex>(j));
+        }
+    }
+    t->relays_.assign(t->classes_.size() * n * n, Relays{});
+
+    // Scratch: class cost matrix, one-relay costs/argmins (best and runner-up), one two-relay row.
+    std::vector<std::int32_t>  cost(n * n), d2(n * n), s2(n * n), d3(n);
+    std::vector<std::uint32_t> a2(n * n), b2(n * n), a3(n);
+    for (std::size_t c = 0; c < t->classes_.size(); ++c) {
+        const OverlayClass& cls = t->classes_[c];
+        for (std::size_t i = 0; i < n * n; ++i) {
+            const bool up = t->rtt_[i] != OverlayMatrix::kDown && (i / n) != (i % n);
+            const std::uint64_t x = up ? overlay_leg_cost(t->rtt_[i], t->loss_[i], cls) : std::uint64_t{kInf};
+            cost[i] = static_cast<std::int32_t>(std::min<std::uint64_t>(x, kInf));
+        }
+        // One relay: D2 = C ⊗ C. The diagonal of C is kInf, so k = i and k = j never win.
+        for (std::size_t i = 0; i < n; ++i)
+            min_plus_row2(&cost[i * n], cost.data(), n, &d2[i * n], &a2[i * n], &s2[i * n], &b2[i * n]);
+        for (std::size_t i = 0; i < n; ++i) d2[i * n + i] = s2[i * n + i] = kInf;  // i → k → i is not a route
+
+        // Two relays: D3 = D2 ⊗ C, row by row; the first relay comes from the D2 argmin.
+        // That relay must not be the destination itself (i → j → k2 → j): where it is,
+        // the entry is redone with D2 row i masked at first relay j, i.e. the runner-up.
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::int32_t*  di = &d2[i * n];
+            const std::uint32_t* ai = &a2[i * n];
+            min_plus_row(di, cost.data(), n, d3.data(), a3.data());
+            for (std::size_t j = 0; j < n; ++j) {
+                if (j == i) continue;
+                Relays& r = t->relays_[(c * n + i) * n + j];
+                if (di[j] < kInf) r.one = static_cast<PopIndex>(ai[j]);
+                if (d3[j] >= kInf) continue;
+                std::uint32_t k2 = a3[j], k1 = ai[k2];
+                if (k1 == j) {
+                    std::int32_t best = kInf;
+                    for (std::size_t l = 0; l < n; ++l) {
+                        const bool via_j = ai[l] == j;
+                        const std::int32_t v = via_j ? s2[i * n + l] : di[l];
+                        if (v >= kInf || v + cost[l * n + j] >= best) continue;
+                        best = v + cost[l * n + j];
+                        k2   = static_cast<std::uint32_t>(l);
+                        k1   = via_j ? b2[i * n + l] : ai[l];
+                    }
+                    if (best >= kInf) continue;
+                }
+                r.two[0] = static_cast<PopIndex>(k1);
+                r.two[1] = static_cast<PopIndex>(k2);
+            }
+        }
+    }
+    return t;
+}
+
+OverlayRoute OverlayTable::compose(const PopIndex* hops, std::size_t count, std::uint8_t cls) const noexcept {
+    const OverlayClass& c = classes_[cls];
+    OverlayRoute r{};
+    r.relays = static_cast<std::uint8_t>(count - 2);
+    for (std::size_t h = 1; h + 1 < count; ++h) r.via[h - 1] = hops[h];
+
+    std::uint64_t rtt = 0, cost = std::uint64_t{c.relay_penalty_us} * r.relays;
+    std::uint64_t pass = kPpm;  // delivery probability (ppm)
+    r.valid = true;
+    for (std::size_t h = 0; h + 1 < count; ++h) {
+        const std::size_t i = std::size_t{hops[h]} * n_ + hops[h + 1];
+        if (hops[h] == hops[h + 1] || rtt_[i] == OverlayMatrix::kDown) { r.valid = false; break; }
+        rtt  += rtt_[i];
+        cost += overlay_leg_cost(rtt_[i], loss_[i], c);
+        pass  = pass * (kPpm - std::min<std::uint64_t>(loss_[i], kPpm)) / kPpm;
+    }
+    if (!r.valid) return r;
+    constexpr std::uint64_t kMax = std::numeric_limits<std::uint32_t>::max();
+    r.rtt_us   = static_cast<std::uint32_t>(std::min(rtt, kMax));
+    r.cost_us  = static_cast<std::uint32_t>(std::min(cost, kMax));
+    r.loss_ppm = static_cast<std::uint32_t>(kPpm - pass);
+    return r;
+}
+
+OverlayRoute OverlayTable::direct(PopIndex from, PopIndex to, std::uint8_t cls) const noexcept {
+    if (from >= n_ || to >= n_ || cls >= classes_.size()) return {};
+    const PopIndex hops[2] = {from, to};
+    return compose(hops, 2, cls);
+}
+
+OverlayRoute OverlayTable::relay(PopIndex from, PopIndex to, std::uint8_t cls, std::uint8_t relays) const noexcept {
+    if (from >= n_ || to >= n_ || cls >= classes_.size() || from == to) return {};
+    const Relays& r = relays_[at(cls, from, to)];
+    if (relays == 1 && r.one != kNoRelay) {
+        const PopIndex hops[3] = {from, r.one, to};
+        return compose(hops, 3, cls);
+    }
+    if (relays == 2 && r.two[1] != kNoRelay) {
+        const PopIndex hops[4] = {from, r.two[0], r.two[1], to};
+        return compose(hops, 4, cls);
+    }
+    return {};
+}
+
+OverlayRoute OverlayTable::best(PopIndex from, PopIndex to, std::uint8_t cls) const noexcept {
+    OverlayRoute b = direct(from, to, cls);
+    for (std::uint8_t k = 1; k <= 2; ++k) {
+        const OverlayRoute r = relay(from, to, cls, k);
+        if (r.valid && (!b.valid || r.cost_us < b.cost_us)) b = r;
+    }
+    return b;
+}
+
+void OverlayTable::relay_updates(PopIndex ingress, std::uint8_t cls,
+                                 std::span<const PathId> one_relay, std::span<const PathId> two_relay,
+                                 std::vector<PathUpdate>& out) const {
+    if (ingress >= n_ || cls >= classes_.size()) return;
+    const std::span<const PathId> ids[2] = {one_relay, two_relay};
+    for (std::size_t j = 0; j < n_; ++j) {
+        const auto to = static_cast<PopIndex>(j);
+        if (to == ingress) continue;
+        const OverlayRoute d = direct(ingress, to, cls);
+        for (std::uint8_t k = 1; k <= 2; ++k) {
+            if (j >= ids[k - 1].size()) continue;
+            const OverlayRoute r = relay(ingress, to, cls, k);
+            PathMetrics pm{};
+            if (r.valid) { pm.rtt_us = r.rtt_us; pm.loss_ppm = r.loss_ppm; }
+            pm.qos_class = cls;
+            pm.healthy   = r.valid && (!d.valid || r.cost_us < d.cost_us);
+            out.push_back({ids[k - 1][j], pm});
+        }
+    }
+}
+
+OverlayRouter::OverlayRouter(std::vector<OverlayClass> classes)
+: classes_(std::move(classes)), current_(OverlayTable::compute(OverlayMatrix(0), classes_)) {}
+
+std::shared_ptr<const OverlayTable> OverlayRouter::recompute(const OverlayMatrix& m) {
+    std::shared_ptr<const OverlayTable> t = OverlayTable::build(m, classes_, ++generation_);
+    std::atomic_store_explicit(&current_, t, std::memory_order_release);
+    return t;
+}
+
+} // namespace alpha::routing
@@ -1,5 +1,7 @@
 #include "alpha/routing/path_selection.hpp"
 
+#include <bit>
+
 namespace alpha::routing {
 
 namespace {
@@ -7,7 +9,7 @@ struct XorShift32 {
     std::uint32_t state;
     explicit XorShift32(std::uint32_t seed) : state(seed ? seed : 0x9E3779B9u) {}
     std::uint32_t next() noexcept { auto x=state; x^=x<<13; x^=x>>17; x^=x<<5; return state=x; }
-    std::uint32_t next_bounded(std::uint32_t b) noexcept { return b? next()%b : 0u; }
+    std::uint32_t next_bounded(std::uint32_t b) noexcept { return fast_range32(next(), b); }
 };
 }
 
@@ -33,6 +35,41 @@ bool dp::load_metrics(const MetricsSlot& s, PathMetrics& out) noexcept {
     return false;
 }
 
+// --------- CP / DP left-right ops ---------
+
+namespace {
+void wait_drained(const std::atomic<std::uint32_t>& readers) noexcept {
+    while (readers.load(std::memory_order_acquire) != 0) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    }
+}
+}
+
+void cp::update_metrics(LrMetricsSlot& s, const PathMetrics& m) noexcept {
+    // 1) Fill the copy readers are not using and steer new readers to it.
+    const auto lr = s.left_right.load(std::memory_order_relaxed);
+    s.copy[lr ^ 1u] = m;
+    s.left_right.store(lr ^ 1u, std::memory_order_seq_cst);
+
+    // 2) Toggle the read-indicator, draining each side so no reader can still be on copy[lr].
+    const auto vi = s.version.load(std::memory_order_relaxed);
+    wait_drained(s.readers[vi ^ 1u]);
+    s.version.store(vi ^ 1u, std::memory_order_seq_cst);
+    wait_drained(s.readers[vi]);
+
+    // 3) Nobody reads copy[lr] now: bring it up to date for the next flip.
+    s.copy[lr] = m;
+}
+
+void dp::load_metrics(const LrMetricsSlot& s, PathMetrics& out) noexcept {
+    const auto vi = s.version.load(std::memory_order_seq_cst);
+    s.readers[vi].fetch_add(1, std::memory_order_seq_cst);
+    out = s.copy[s.left_right.load(std::memory_order_seq_cst)];
+    s.readers[vi].fetch_sub(1, std::memory_order_release);
+}
+
 bool qos_match(std::uint8_t path_class, std::uint8_t /*dscp*/) noexcept {
     return path_class != 0; // placeholder: treat non-zero class as a weak match
 }
@@ -59,17 +96,39 @@ PathId FlowHashPolicy::choose(std::span<const CandidateRef> cands,
                               const PacketContext& pkt) noexcept {
     const auto n = static_cast<std::uint32_t>(cands.size());
     if (n == 0) return 0;
-    const auto base = pkt.flow_hash % n;
+    const auto base = fast_range32(pkt.flow_hash, n);
     if (!skip_unhealthy_) return cands[base].id;
 
     PathMetrics m{};
-    for (std::uint32_t i=0;i<n;++i) {
-        const auto k = (base + i) % n;
+    for (std::uint32_t i=0, k=base;i<n;++i, k = (k + 1 == n) ? 0u : k + 1) {
         if (dp::load_metrics(*cands[k].slot, m) && m.healthy) return cands[k].id;
     }
     return cands[base].id; // keep mapping stable if all unhealthy
 }
 
+template <std::size_t N>
+PathId FlowHashPolicy::choose_n(std::span<const CandidateRef, N> cands,
+                                const PacketContext& pkt) noexcept {
+    static_assert(N >= kMinFixedCandidates && N <= kMaxFixedCandidates);
+    constexpr auto n = static_cast<std::uint32_t>(N);
+    const auto base = fast_range32(pkt.flow_hash, n);
+    if (!skip_unhealthy_) return cands[base].id;
+
+    // All N seqlock reads are independent; gather them into a healthy bitmask.
+    std::uint32_t mask = 0; PathMetrics m{};
+    for (std::uint32_t i=0;i<n;++i) {
+        const bool ok = dp::load_metrics(*cands[i].slot, m);
+        mask |= static_cast<std::uint32_t>(ok & m.healthy) << i;
+    }
+    // Rotate so bit 0 is `base`: the lowest set bit is the first healthy path at or
+    // after base (cyclic). No healthy path → ctz hits the sentinel bit n → base.
+    constexpr std::uint32_t full = (1u << n) - 1u;
+    const std::uint32_t rot = ((mask >> base) | (mask << (n - base))) & full;
+    std::uint32_t k = base + static_cast<std::uint32_t>(std::countr_zero(rot | (1u << n)));
+    k = (k >= n) ? k - n : k;
+    return cands[k].id;
+}
+
 LatencyAwarePolicy::LatencyAwarePolicy(LatencyAwareConfig cfg) noexcept : cfg_(cfg) {}
 
 PathId LatencyAwarePolicy::choose(std::span<const CandidateRef> cands,
@@ -117,4 +176,47 @@ PathId LatencyAwarePolicy::choose(std::span<const CandidateRef> cands,
     return cands[best].id;
 }
 
+template <std::size_t N>
+PathId LatencyAwarePolicy::choose_n(std::span<const CandidateRef, N> cands,
+                                    const PacketContext& pkt) noexcept {
+    static_assert(N >= kMinFixedCandidates && N <= kMaxFixedCandidates);
+    if (cfg_.explore_ppm) return choose(cands, pkt);
+
+    PathMetrics m[N]; bool ok[N];
+    for (std::size_t i=0;i<N;++i) ok[i] = dp::load_metrics(*cands[i].slot, m[i]);
+
+    // Same scan order and tie-break as choose(), expressed as selects (cmov) instead of branches.
+    std::size_t best = 0; std::uint32_t best_rtt = 0; bool best_q = false; bool have = false;
+    for (std::size_t i=0;i<N;++i) {
+        const bool h     = ok[i] & m[i].healthy;
+        const bool q     = qos_match(m[i].qos_class, pkt.dscp);
+        const bool lower = !have | (m[i].rtt_us < best_rtt);
+        const bool close = m[i].rtt_us <= best_rtt + cfg_.tie_margin_us;
+        const bool take  = h & (lower | (cfg_.prefer_qos_class & close & q & !best_q));
+        best     = take ? i : best;
+        best_rtt = take ? m[i].rtt_us : best_rtt;
+        best_q   = take ? q : best_q;
+        have     = have | h;
+    }
+    if (have) return cands[best].id;
+
+    // No healthy: absolute min RTT over the metrics already loaded.
+    std::size_t idx = 0; std::uint32_t min_rtt = 0; bool init = false;
+    for (std::size_t i=0;i<N;++i) {
+        const bool take = ok[i] & (!init | (m[i].rtt_us < min_rtt));
+        idx     = take ? i : idx;
+        min_rtt = take ? m[i].rtt_us : min_rtt;
+        init    = init | ok[i];
+    }
+    return cands[idx].id;
+}
+
+// Fixed-count instantiations dispatched by cp::publish_policy(b, policy, n_cands).
+template PathId FlowHashPolicy::choose_n<2>(std::span<const CandidateRef, 2>, const PacketContext&) noexcept;
+template PathId FlowHashPolicy::choose_n<3>(std::span<const CandidateRef, 3>, const PacketContext&) noexcept;
+template PathId FlowHashPolicy::choose_n<4>(std::span<const CandidateRef, 4>, const PacketContext&) noexcept;
+template PathId LatencyAwarePolicy::choose_n<2>(std::span<const CandidateRef, 2>, const PacketContext&) noexcept;
+template PathId LatencyAwarePolicy::choose_n<3>(std::span<const CandidateRef, 3>, const PacketContext&) noexcept;
+template PathId LatencyAwarePolicy::choose_n<4>(std::span<const CandidateRef, 4>, const PacketContext&) noexcept;
+
 } // namespace alpha::routing
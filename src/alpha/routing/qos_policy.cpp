@@ -8,38 +8,67 @@
 
 namespace alpha::routing {
 
+QoSProfile to_profile(const QoSConfig& cfg) {
+    QoSProfile p{};
+    p.dscp_mapped = 0;
+    for (std::size_t c = 0; c < kQoSClassCount; ++c) {
+        const auto clazz = static_cast<QoSClass>(c);
+        const auto th = cfg.thresholds_by_class.find(clazz);
+        p.thresholds[c] = th == cfg.thresholds_by_class.end() ? QoSThresholds{} : th->second;
+        const auto ds = cfg.dscp_by_class.find(clazz);
+        if (ds == cfg.dscp_by_class.end()) continue;
+        p.dscp[c] = ds->second;
+        p.dscp_mapped = static_cast<uint8_t>(p.dscp_mapped | (1u << c));
+    }
+    p.weights = cfg.weights;
+    return p;
+}
+
+QoSConfig to_config(const QoSProfile& p) {
+    QoSConfig cfg;
+    for (std::size_t c = 0; c < kQoSClassCount; ++c) {
+        const auto clazz = static_cast<QoSClass>(c);
+        cfg.thresholds_by_class.emplace(clazz, p.thresholds[c]);
+        if (p.dscp_mapped & (1u << c)) cfg.dscp_by_class.emplace(clazz, p.dscp[c]);
+    }
+    cfg.weights = p.weights;
+    return cfg;
+}
+
 QoSPolicy::QoSPolicy(QoSConfig cfg) noexcept
-    : cfg_(std::move(cfg)) {}
+    : cfg_(std::move(cfg)), tab_(build_qos_tables(to_profile(cfg_))) {}
+
+QoSPolicy::QoSPolicy(const QoSProfile& profile, const QoSTables& tables)
+    : cfg_(to_config(profile)), tab_(tables) {}
 
 uint8_t QoSPolicy::dscp(QoSClass clazz) const noexcept {
-    const auto it = cfg_.dscp_by_class.find(clazz);
-    // Default to Best Effort (0) when unmapped.
-    return it == cfg_.dscp_by_class.end() ? uint8_t{0} : it->second;
+    // Unmapped classes were flattened to 0 (Best Effort).
+    const auto c = static_cast<std::size_t>(clazz);
+    return c < kQoSClassCount ? tab_.dscp_by_class[c] : uint8_t{0};
 }
 
 QoSScore QoSPolicy::score_path(const PathMetrics& pm, QoSClass clazz) const noexcept {
     QoSScore out{pm.path_id, 0.0, true};
 
-    // Fetch thresholds for the class; fall back to conservative defaults.
-    const auto th_it = cfg_.thresholds_by_class.find(clazz);
-    const QoSThresholds th = (th_it == cfg_.thresholds_by_class.end())
-        ? QoSThresholds{} : th_it->second;
-
-    // Normalize each metric: ~1.0 means "meets target," <1.0 means "worse than target."
-    const double nlat  = normalize_latency(pm.latency_us, th.max_latency_us);
-    const double njit  = normalize_jitter(pm.jitter_us,   th.max_jitter_us);
-    const double nloss = normalize_loss(pm.loss,          th.max_loss);
-
     // Binary compliance flag (useful for strict modes or observability tags).
-    out.within_thresholds = (pm.latency_us <= th.max_latency_us) &&
-                            (pm.jitter_us  <= th.max_jitter_us) &&
-                            (pm.loss       <= th.max_loss);
+    out.within_thresholds = qos_within(tab_, clazz, pm.latency_us, pm.jitter_us, pm.loss);
 
-    // Weighted blend into a single score; higher is better.
-    out.score = blend(nlat, njit, nloss, cfg_.weights);
+    // Normalized, weighted blend into a single score; higher is better.
+    out.score = qos_score(tab_, clazz, pm.latency_us, pm.jitter_us, pm.loss);
     return out;
 }
 
+QoSScore QoSPolicy::score_path(const PathMetrics& pm, QoSClass clazz, const MetricForecaster& f,
+                               std::size_t series, std::uint32_t horizon) const noexcept {
+    PathMetrics ahead{};
+    ahead.path_id   = pm.path_id;
+    ahead.jitter_us = pm.jitter_us;
+    const double rtt = std::min<double>(f.rtt_us(series, horizon), 4294967295.0);
+    ahead.latency_us = std::max(pm.latency_us, static_cast<uint32_t>(rtt));
+    ahead.loss       = std::max(pm.loss, static_cast<double>(f.loss(series, horizon)));
+    return score_path(ahead, clazz);
+}
+
 std::optional<QoSScore> QoSPolicy::choose_best(const std::vector<PathMetrics>& candidates,
                                                QoSClass clazz,
                                                bool require_within_thresholds) const noexcept {
@@ -74,33 +103,9 @@ QoSConfig QoSPolicy::config() const {
 }
 
 void QoSPolicy::update_config(QoSConfig cfg) noexcept {
-    // Single writer pattern expected (control-plane).
+    // Single writer pattern expected (control-plane). Runtime override: rebuild tables.
+    tab_ = build_qos_tables(to_profile(cfg));
     cfg_ = std::move(cfg);
 }
 
-double QoSPolicy::normalize_latency(uint32_t latency_us, uint32_t target_us) noexcept {
-    if (target_us == 0) return 0.0; // avoid div by zero; treat as non-compliant
-    // <= target → 1.0; above target → decays smoothly toward 0.
-    const double ratio = static_cast<double>(latency_us) / static_cast<double>(target_us);
-    return 1.0 / (1.0 + std::max(0.0, ratio - 1.0));
-}
-
-double QoSPolicy::normalize_jitter(uint32_t jitter_us, uint32_t target_us) noexcept {
-    if (target_us == 0) return 0.0;
-    const double ratio = static_cast<double>(jitter_us) / static_cast<double>(target_us);
-    return 1.0 / (1.0 + std::max(0.0, ratio - 1.0));
-}
-
-double QoSPolicy::normalize_loss(double loss, double target) noexcept {
-    if (target <= 0.0) return 0.0;
-    const double ratio = loss / target;
-    return 1.0 / (1.0 + std::max(0.0, ratio - 1.0));
-}
-
-double QoSPolicy::blend(double nlat, double njit, double nloss, const QoSWeights& w) noexcept {
-    const double sumw = std::max(1e-9, w.latency + w.jitter + w.loss);
-    const double raw  = (nlat * w.latency + njit * w.jitter + nloss * w.loss) / sumw;
-    return std::clamp(raw, 0.0, 1.0);
-}
-
 } // namespace alpha::routing
@@ -0,0 +1,200 @@
+/**
+ * @file rss_table.cpp
+ * @brief Implementation of RssTable (indirection + migration) and RssRebalancer.
+ */
+#include "alpha/routing/rss_table.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace alpha::routing {
+
+// ---------------- RssTable ----------------
+
+RssTable::RssTable(WorkerId workers, std::size_t handoff_capacity)
+    : workers_(workers),
+      handoff_capacity_(handoff_capacity),
+      rows_(std::make_unique<CounterRow[]>(workers)) {
+    if (workers == 0) {
+        std::abort(); // RT bring-up: at least one worker is required.
+    }
+    for (std::size_t b = 0; b < kRssBuckets; ++b) {
+        owner_[b].store(static_cast<WorkerId>(b % workers), std::memory_order_relaxed);
+    }
+    // Preallocate handoff buffers so the Export phase never allocates on a worker.
+    for (auto& m : migrations_) m.handoff.reserve(handoff_capacity_);
+}
+
+void RssTable::import_handoff(MigrationSlot& m, SlotState s, FlowTable& flows) noexcept {
+    for (const auto& e : m.handoff) {
+        // A pin created locally after the flip is newer; keep it.
+        if (!flows.find(e.key)) (void)flows.insert(e.key, e.hash, e.path);
+    }
+    s.phase = MigrationPhase::Purge;
+    m.state.store(SlotState::pack(s), std::memory_order_release);
+}
+
+std::size_t RssTable::service_migrations(WorkerId self, FlowTable& flows) noexcept {
+    std::size_t executed = 0;
+    for (auto& m : migrations_) {
+        SlotState s = SlotState::unpack(m.state.load(std::memory_order_acquire));
+        if (s.phase == MigrationPhase::Idle) continue;
+
+        const std::uint32_t bucket = s.bucket;
+        const auto in_bucket = [bucket](const FlowEntry& e) noexcept {
+            return bucket_of(e.hash) == bucket;
+        };
+
+        if (s.phase == MigrationPhase::Export && s.from == self) {
+            m.handoff.clear();
+            std::uint64_t dropped = 0;
+            flows.for_each([&](const FlowEntry& e) {
+                if (!in_bucket(e)) return;
+                if (m.handoff.size() < handoff_capacity_) m.handoff.push_back(e);
+                else ++dropped;
+            });
+            if (dropped) handoff_dropped_.fetch_add(dropped, std::memory_order_relaxed);
+            // Import is visible before the flip: a packet dispatched to the new owner
+            // (owner acquire → ring → worker) finds the filled handoff announced.
+            s.phase = MigrationPhase::Import;
+            m.state.store(SlotState::pack(s), std::memory_order_release);
+            owner_[bucket].store(s.to, std::memory_order_release);
+            ++executed;
+        } else if (s.phase == MigrationPhase::Import && s.to == self) {
+            import_handoff(m, s, flows);
+            ++executed;
+        } else if (s.phase == MigrationPhase::Purge && s.from == self) {
+            (void)flows.erase_if(in_bucket);
+            m.state.store(SlotState::pack({}), std::memory_order_release);
+            ++executed;
+        }
+    }
+    return executed;
+}
+
+bool RssTable::adopt(WorkerId self, std::uint32_t flow_hash, FlowTable& flows) noexcept {
+    const std::uint32_t bucket = bucket_of(flow_hash);
+    for (auto& m : migrations_) {
+        const SlotState s = SlotState::unpack(m.state.load(std::memory_order_acquire));
+        if (s.phase != MigrationPhase::Import || s.to != self || s.bucket != bucket) continue;
+        import_handoff(m, s, flows);
+        return true;
+    }
+    return false;
+}
+
+void RssTable::collect_load(std::span<std::uint64_t, kRssBuckets> out) noexcept {
+    for (std::size_t b = 0; b < kRssBuckets; ++b) {
+        std::uint32_t total = 0;
+        for (std::size_t w = 0; w < workers_; ++w) {
+            total += rows_[w].packets[b].load(std::memory_order_relaxed);
+        }
+        // Counters are monotonic (mod 2^32); the delta is exact while an interval
+        // stays below 2^32 packets per bucket.
+        out[b] = static_cast<std::uint32_t>(total - prev_total_[b]);
+        prev_total_[b] = total;
+    }
+}
+
+void RssTable::owners(std::span<WorkerId, kRssBuckets> out) const noexcept {
+    for (std::size_t b = 0; b < kRssBuckets; ++b) {
+        out[b] = owner_[b].load(std::memory_order_relaxed);
+    }
+}
+
+bool RssTable::migrating(std::uint32_t bucket) const noexcept {
+    for (const auto& m : migrations_) {
+        const SlotState s = SlotState::unpack(m.state.load(std::memory_order_acquire));
+        if (s.phase != MigrationPhase::Idle && s.bucket == bucket) return true;
+    }
+    return false;
+}
+
+bool RssTable::begin_migration(const BucketMove& mv) noexcept {
+    if (mv.bucket >= kRssBuckets || mv.from >= workers_ || mv.to >= workers_ || mv.from == mv.to) return false;
+    if (owner_[mv.bucket].load(std::memory_order_relaxed) != mv.from) return false;
+    if (migrating(mv.bucket)) return false;
+
+    for (auto& m : migrations_) {
+        if (SlotState::unpack(m.state.load(std::memory_order_acquire)).phase != MigrationPhase::Idle) continue;
+        m.state.store(SlotState::pack({MigrationPhase::Export, mv.bucket, mv.from, mv.to}),
+                      std::memory_order_release);
+        return true;
+    }
+    return false; // all slots busy; retry next round
+}
+
+// ---------------- RssRebalancer ----------------
+
+double RssRebalancer::imbalance(std::span<const std::uint64_t> worker_load) noexcept {
+    if (worker_load.empty()) return 1.0;
+    std::uint64_t sum = 0, mx = 0;
+    for (auto l : worker_load) { sum += l; mx = std::max(mx, l); }
+    if (sum == 0) return 1.0;
+    const double mean = static_cast<double>(sum) / static_cast<double>(worker_load.size());
+    return static_cast<double>(mx) / mean;
+}
+
+std::vector<BucketMove>
+RssRebalancer::plan(std::span<const std::uint64_t, kRssBuckets> bucket_load,
+                    std::span<const WorkerId, kRssBuckets> owner,
+                    WorkerId workers,
+                    std::span<const std::uint8_t> skip) const {
+    std::vector<BucketMove> moves;
+    if (workers < 2) return moves;
+
+    std::array<WorkerId, kRssBuckets> own{};
+    std::copy(owner.begin(), owner.end(), own.begin());
+    std::vector<std::uint64_t> wload(workers, 0);
+    for (std::size_t b = 0; b < kRssBuckets; ++b) wload[own[b]] += bucket_load[b];
+
+    std::array<bool, kRssBuckets> moved{};
+    for (std::uint32_t round = 0; round < cfg_.max_moves; ++round) {
+        if (imbalance(wload) <= cfg_.target_ratio) break;
+
+        const auto hot  = static_cast<WorkerId>(std::max_element(wload.begin(), wload.end()) - wload.begin());
+        const auto cold = static_cast<WorkerId>(std::min_element(wload.begin(), wload.end()) - wload.begin());
+        const std::uint64_t gap = wload[hot] - wload[cold];
+
+        // Best bucket: strictly inside (0, gap) so the move lowers the maximum,
+        // and as close to gap/2 as possible so hot and cold meet in the middle.
+        std::size_t best = kRssBuckets;
+        std::uint64_t best_err = ~std::uint64_t{0};
+        for (std::size_t b = 0; b < kRssBuckets; ++b) {
+            if (own[b] != hot || moved[b]) continue;
+            if (b < skip.size() && skip[b]) continue;
+            const std::uint64_t l = bucket_load[b];
+            if (l == 0 || l >= gap) continue;
+            const std::uint64_t half = gap / 2;
+            const std::uint64_t err = (l > half) ? l - half : half - l;
+            if (err < best_err) { best = b; best_err = err; }
+        }
+        if (best == kRssBuckets) break; // a single hot bucket dominates; nothing helps
+
+        moves.push_back(BucketMove{static_cast<std::uint16_t>(best), hot, cold});
+        moved[best] = true;
+        own[best] = cold;
+        wload[hot]  -= bucket_load[best];
+        wload[cold] += bucket_load[best];
+    }
+    return moves;
+}
+
+std::size_t RssRebalancer::run_once(RssTable& table) const {
+    std::array<std::uint64_t, kRssBuckets> load{};
+    std::array<WorkerId, kRssBuckets> own{};
+    std::array<std::uint8_t, kRssBuckets> busy{};
+    table.collect_load(load);
+    table.owners(own);
+    for (std::size_t b = 0; b < kRssBuckets; ++b) {
+        busy[b] = table.migrating(static_cast<std::uint32_t>(b)) ? 1 : 0;
+    }
+
+    std::size_t started = 0;
+    for (const auto& mv : plan(load, own, table.workers(), busy)) {
+        if (table.begin_migration(mv)) ++started;
+    }
+    return started;
+}
+
+} // namespace alpha::routing
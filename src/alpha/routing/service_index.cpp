@@ -0,0 +1,91 @@
+/**
+ * @file service_index.cpp
+ * @brief Compilation and (burst) lookup for ServiceIndex.
+ */
+#include "alpha/routing/service_index.hpp"
+#include "alpha/mem/prefetch.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace alpha::routing {
+
+std::uint64_t ServiceIndex::hash_id(std::string_view id) noexcept {
+    // FNV-1a over the bytes, then a splitmix finalizer for well-spread low bits.
+    std::uint64_t h = 0xcbf29ce484222325ULL;
+    for (char c : id) { h ^= static_cast<unsigned char>(c); h *= 0x100000001b3ULL; }
+    h ^= h >> 30; h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27; h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+    return h | 1u; // never 0: 0 marks an empty slot
+}
+
+std::shared_ptr<const ServiceIndex> ServiceIndex::compile(const ServiceRegistry& reg) {
+    // Version first: a concurrent publish can only make us look older than our
+    // content, which triggers a harmless recompile.
+    const auto v = reg.version();
+    return compile(reg.snapshot(), v);
+}
+
+std::shared_ptr<const ServiceIndex>
+ServiceIndex::compile(std::shared_ptr<const ServiceRegistry::Map> snap, std::uint64_t version) {
+    std::shared_ptr<ServiceIndex> idx(new ServiceIndex());
+    idx->version_ = version;
+    idx->snap_ = std::move(snap);
+    if (!idx->snap_) idx->snap_ = std::make_shared<const ServiceRegistry::Map>();
+
+    // Deterministic handles: sort ids.
+    std::vector<const ServiceRegistry::Map::value_type*> entries;
+    entries.reserve(idx->snap_->size());
+    for (const auto& kv : *idx->snap_) entries.push_back(&kv);
+    std::sort(entries.begin(), entries.end(),
+              [](const auto* a, const auto* b) { return a->first < b->first; });
+
+    idx->ids_.reserve(entries.size());
+    idx->pops_.reserve(entries.size());
+    for (const auto* e : entries) {
+        idx->ids_.emplace_back(e->first);
+        idx->pops_.push_back(&e->second);
+    }
+
+    // Load factor <= 1/2.
+    const std::size_t cap = std::bit_ceil(std::max<std::size_t>(entries.size() * 2, 8));
+    idx->slots_.assign(cap, Slot{});
+    idx->mask_ = cap - 1;
+    for (ServiceHandle hd = 0; hd < idx->ids_.size(); ++hd) {
+        const std::uint64_t h = hash_id(idx->ids_[hd]);
+        std::size_t i = static_cast<std::size_t>(h) & idx->mask_;
+        while (idx->slots_[i].hash != 0) i = (i + 1) & idx->mask_;
+        idx->slots_[i] = Slot{h, hd, static_cast<std::uint32_t>(idx->ids_[hd].size())};
+    }
+    return idx;
+}
+
+ServiceHandle ServiceIndex::probe(std::uint64_t h, std::string_view id) const noexcept {
+    for (std::size_t i = static_cast<std::size_t>(h) & mask_;; i = (i + 1) & mask_) {
+        const Slot& s = slots_[i];
+        if (s.hash == 0) return kInvalidService;
+        if (s.hash == h && s.len == id.size() && ids_[s.handle] == id) return s.handle;
+    }
+}
+
+ServiceHandle ServiceIndex::find(std::string_view id) const noexcept {
+    return probe(hash_id(id), id);
+}
+
+void ServiceIndex::find_burst(std::span<const std::string_view> ids,
+                              std::span<ServiceHandle> out) const noexcept {
+    std::uint64_t hs[kPrefetchGroup];
+    for (std::size_t base = 0; base < ids.size(); base += kPrefetchGroup) {
+        const std::size_t n = std::min(kPrefetchGroup, ids.size() - base);
+        // Stage 1: hash and prefetch every slot.
+        for (std::size_t i = 0; i < n; ++i) {
+            hs[i] = hash_id(ids[base + i]);
+            alpha::mem::prefetch_read(&slots_[static_cast<std::size_t>(hs[i]) & mask_]);
+        }
+        // Stage 2: probe (hash/length reject first, string compare on candidates).
+        for (std::size_t i = 0; i < n; ++i) out[base + i] = probe(hs[i], ids[base + i]);
+    }
+}
+
+} // namespace alpha::routing
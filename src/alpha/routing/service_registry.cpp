@@ -136,6 +136,113 @@ void ServiceRegistry::clear() noexcept {
     // Not counting as failure/success here; treated as maintenance op.
 }
 
+//------------------------------- Snapshot transfer ----------------------------
+// Format (little-endian host order; producer and consumer share the ABI):
+//   u32 magic | u32 service_count |
+//   per service: str id | u8 pop_count | per pop: str id | str region | str ip | u16 weight | u8 health | u64 srlg
+//   where str = u8 length + bytes (all strings are bounded by Limits, so u8 suffices).
+
+namespace {
+constexpr std::uint32_t kSnapshotMagic = 0x52475332u; // "RGS2" (RGS1 + per-PoP srlg)
+
+struct Writer {
+    std::span<std::byte> out;
+    std::size_t pos{0};
+    bool ok{true};
+    void raw(const void* p, std::size_t n) noexcept {
+        if (!ok || out.size() - pos < n) { ok = false; return; }
+        std::memcpy(out.data() + pos, p, n);
+        pos += n;
+    }
+    template <class T> void put(T v) noexcept { raw(&v, sizeof(T)); }
+    void str(std::string_view s) noexcept {
+        if (s.size() > 0xFF) { ok = false; return; }
+        put(static_cast<std::uint8_t>(s.size()));
+        raw(s.data(), s.size());
+    }
+};
+
+struct Reader {
+    std::span<const std::byte> in;
+    std::size_t pos{0};
+    bool ok{true};
+    void raw(void* p, std::size_t n) noexcept {
+        if (!ok || in.size() - pos < n) { ok = false; return; }
+        std::memcpy(p, in.data() + pos, n);
+        pos += n;
+    }
+    template <class T> T get() noexcept { T v{}; raw(&v, sizeof(T)); return v; }
+    std::string str() {
+        const auto n = get<std::uint8_t>();
+        std::string s(n, '\0');
+        raw(s.data(), n);
+        return s;
+    }
+};
+} // namespace
+
+std::size_t ServiceRegistry::serializeSnapshot(std::span<std::byte> out) const noexcept {
+    auto snap = snapshot();
+    if (!snap) return 0;
+    Writer w{out};
+    w.put(kSnapshotMagic);
+    w.put(static_cast<std::uint32_t>(snap->size()));
+    for (const auto& [id, pops] : *snap) {
+        w.str(id);
+        w.put(static_cast<std::uint8_t>(pops.size()));
+        for (const auto& p : pops) {
+            w.str(p.id);
+            w.str(p.region);
+            w.str(p.ip);
+            w.put(p.weight);
+            w.put(static_cast<std::uint8_t>(p.health));
+            w.put(p.srlg);
+        }
+    }
+    return w.ok ? w.pos : 0;
+}
+
+RegistryErr ServiceRegistry::restoreSnapshot(std::span<const std::byte> in) {
+    Reader r{in};
+    const auto magic = r.get<std::uint32_t>();
+    const auto count = r.get<std::uint32_t>();
+    if (!r.ok || magic != kSnapshotMagic || count > Limits::MaxServices) {
+        failures_.fetch_add(1, std::memory_order_relaxed);
+        return RegistryErr::Invalid;
+    }
+
+    auto next = std::make_shared<Map>();
+    next->reserve(count);
+    for (std::uint32_t i = 0; i < count && r.ok; ++i) {
+        std::string id = r.str();
+        PopList pops(r.get<std::uint8_t>());
+        for (auto& p : pops) {
+            p.id     = r.str();
+            p.region = r.str();
+            p.ip     = r.str();
+            p.weight = r.get<std::uint16_t>();
+            const auto h = r.get<std::uint8_t>();
+            if (h > static_cast<std::uint8_t>(Health::Down)) r.ok = false;
+            p.health = static_cast<Health>(h);
+            p.srlg   = r.get<SrlgMask>();
+        }
+        if (!r.ok || !validateId(id, Limits::MaxIdLen) || !validatePops(pops) ||
+            !next->emplace(std::move(id), std::move(pops)).second) {
+            r.ok = false;
+        }
+    }
+    if (!r.ok) {
+        failures_.fetch_add(1, std::memory_order_relaxed);
+        return RegistryErr::Invalid;
+    }
+
+    // RCU update: publish the restored map as one snapshot.
+    std::shared_ptr<const Map> cnext = std::move(next);
+    std::atomic_store_explicit(&map_, std::move(cnext), std::memory_order_release);
+    version_.fetch_add(1, std::memory_order_relaxed);
+    return RegistryErr::Ok;
+}
+
 //------------------------------- Mutation Core --------------------------------
 
 RegistryErr ServiceRegistry::mutate(Mode mode, std::string_view service_id, const PopList& pops) {
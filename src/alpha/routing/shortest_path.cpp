@@ -0,0 +1,271 @@
+/**
+ * @file shortest_path.cpp
+ * @brief Incremental (Ramalingam–Reps style) shortest-path maintenance and copy-on-write publication.
+ */
+#include "alpha/routing/shortest_path.hpp"
+
+#include <algorithm>
+#include <functional>
+
+namespace alpha::routing {
+
+namespace {
+constexpr std::uint64_t kInf = ShortestPathSnapshot::kUnreachable;
+}
+
+// ---------------------------- Snapshot ----------------------------
+
+PopIndex ShortestPathSnapshot::next_hop(PopIndex src, PopIndex dst) const noexcept {
+    const Row* r = row(src);
+    if (!r || dst >= r->dist.size() || dst == src || r->dist[dst] == kInf) return kNoRelay;
+    PopIndex x = dst;
+    for (std::size_t guard = 0; guard < r->parent.size() && r->parent[x] != src; ++guard) x = r->parent[x];
+    return r->parent[x] == src ? x : kNoRelay;
+}
+
+std::size_t ShortestPathSnapshot::path(PopIndex src, PopIndex dst, std::span<PopIndex> out) const noexcept {
+    const Row* r = row(src);
+    if (!r || dst >= r->dist.size() || r->dist[dst] == kInf) return 0;
+    std::size_t hops = 1;
+    for (PopIndex x = dst; x != src; x = r->parent[x]) {
+        if (r->parent[x] == kNoRelay || hops > r->parent.size()) return 0;
+        ++hops;
+    }
+    if (hops > out.size()) return 0;
+    std::size_t i = hops;
+    for (PopIndex x = dst;; x = r->parent[x]) {
+        out[--i] = x;
+        if (x == src) break;
+    }
+    return hops;
+}
+
+// ---------------------------- Writer ----------------------------
+
+ShortestPaths::ShortestPaths(std::size_t pops, std::span<const PopIndex> sources, std::size_t rebuild_after)
+: n_(std::min(pops, kOverlayMaxPops)),
+  rebuild_after_(rebuild_after ? rebuild_after : n_),
+  w_(n_ * n_, kNoEdge),
+  out_(n_),
+  in_(n_),
+  mark_(n_, 0) {
+    auto add = [this](PopIndex s) {
+        Tree t;
+        t.source = s;
+        t.row.dist.assign(n_, kInf);
+        t.row.parent.assign(n_, kNoRelay);
+        t.row.dist[s] = 0;
+        trees_.push_back(std::move(t));
+    };
+    if (sources.empty()) {
+        for (std::size_t s = 0; s < n_; ++s) add(static_cast<PopIndex>(s));
+    } else {
+        for (const PopIndex s : sources) if (s < n_) add(s);
+    }
+    publish(true);
+}
+
+bool ShortestPaths::set_edge(PopIndex u, PopIndex v, std::uint32_t weight) {
+    if (u >= n_ || v >= n_ || u == v) return false;
+    pending_.push_back({u, v, weight});
+    return true;
+}
+
+void ShortestPaths::load(const OverlayMatrix& m, const OverlayClass& cls) {
+    const std::size_t n = std::min(n_, m.size());
+    for (std::size_t i = 0; i < n; ++i) {
+        for (std::size_t j = 0; j < n; ++j) {
+            const auto u = static_cast<PopIndex>(i), v = static_cast<PopIndex>(j);
+            if (u == v) continue;
+            const std::uint32_t w = m.up(u, v)
+                ? static_cast<std::uint32_t>(std::min<std::uint64_t>(overlay_leg_cost(m.rtt_us(u, v), m.loss_ppm(u, v), cls), kNoEdge - 1))
+                : kNoEdge;
+            if (w != weight(u, v)) pending_.push_back({u, v, w});
+        }
+    }
+}
+
+void ShortestPaths::write_edge(PopIndex u, PopIndex v, std::uint32_t weight) {
+    std::uint32_t& w = w_[std::size_t{u} * n_ + v];
+    if (w == kNoEdge && weight != kNoEdge) {
+        out_[u].push_back(v);
+        in_[v].push_back(u);
+    } else if (w != kNoEdge && weight == kNoEdge) {
+        auto drop = [](std::vector<PopIndex>& l, PopIndex x) {
+            const auto it = std::find(l.begin(), l.end(), x);
+            *it = l.back();
+            l.pop_back();
+        };
+        drop(out_[u], v);
+        drop(in_[v], u);
+    }
+    w = weight;
+}
+
+ShortestPaths::Stats ShortestPaths::apply() {
+    Stats st{};
+    st.changes = pending_.size();
+    if (pending_.empty()) return st;
+
+    if (pending_.size() > rebuild_after_) {
+        for (const Change& c : pending_) write_edge(c.u, c.v, c.weight);
+        pending_.clear();
+        rebuild();
+        st.rebuilt    = true;
+        st.recomputed = trees_.size() * n_;
+        st.rows       = trees_.size();
+        return st;
+    }
+
+    for (const Change& c : pending_) {
+        const std::uint32_t old = weight(c.u, c.v);
+        if (old == c.weight) continue;
+        write_edge(c.u, c.v, c.weight);
+        for (Tree& t : trees_) st.recomputed += c.weight < old ? decrease(t, c.u, c.v) : increase(t, c.u, c.v);
+    }
+    pending_.clear();
+    for (const Tree& t : trees_) st.rows += t.dirty ? 1u : 0u;
+    if (st.rows != 0) publish(false);
+    return st;
+}
+
+void ShortestPaths::rebuild() {
+    for (Tree& t : trees_) full(t);
+    publish(true);
+}
+
+void ShortestPaths::push(std::uint64_t d, PopIndex x) {
+    heap_.emplace_back(d, x);
+    std::push_heap(heap_.begin(), heap_.end(), std::greater<>{});
+}
+
+std::size_t ShortestPaths::settle(Tree& t) {
+    auto& dist = t.row.dist;
+    auto& parent = t.row.parent;
+    std::size_t settled = 0;
+    while (!heap_.empty()) {
+        std::pop_heap(heap_.begin(), heap_.end(), std::greater<>{});
+        const auto [d, x] = heap_.back();
+        heap_.pop_back();
+        if (d != dist[x]) continue;  // stale entry
+        ++settled;
+        const std::uint32_t* row = &w_[std::size_t{x} * n_];
+        for (const PopIndex y : out_[x]) {
+            const std::uint64_t nd = d + row[y];
+            if (nd < dist[y]) {
+                dist[y] = nd;
+                parent[y] = x;
+                push(nd, y);
+            }
+        }
+    }
+    return settled;
+}
+
+bool ShortestPaths::descends(const Tree& t, PopIndex x, PopIndex ancestor) const noexcept {
+    for (std::size_t guard = 0; x != kNoRelay && guard <= n_; ++guard, x = t.row.parent[x]) {
+        if (x == ancestor) return true;
+    }
+    return false;
+}
+
+std::size_t ShortestPaths::decrease(Tree& t, PopIndex u, PopIndex v) {
+    auto& dist = t.row.dist;
+    if (dist[u] == kInf) return 0;
+    const std::uint64_t nd = dist[u] + weight(u, v);
+    if (nd >= dist[v]) return 0;
+    dist[v] = nd;
+    t.row.parent[v] = u;
+    t.dirty = true;
+    heap_.clear();
+    push(nd, v);
+    return settle(t);
+}
+
+std::size_t ShortestPaths::increase(Tree& t, PopIndex u, PopIndex v) {
+    auto& dist = t.row.dist;
+    auto& parent = t.row.parent;
+    if (parent[v] != u) return 0;  // not on the tree: no shortest path used it
+
+    // Another shortest path of the same length into v (outside v's subtree): re-parent only.
+    const std::uint64_t dv = dist[v];
+    for (const PopIndex p : in_[v]) {
+        if (dist[p] != kInf && dist[p] + weight(p, v) == dv && !descends(t, p, v)) {
+            parent[v] = p;
+            t.dirty = true;
+            return 1;
+        }
+    }
+
+    // Affected set: v's subtree.
+    affected_.clear();
+    stack_.assign(1, v);
+    mark_[v] = 1;
+    while (!stack_.empty()) {
+        const PopIndex x = stack_.back();
+        stack_.pop_back();
+        affected_.push_back(x);
+        for (const PopIndex y : out_[x]) {
+            if (parent[y] == x && !mark_[y]) { mark_[y] = 1; stack_.push_back(y); }
+        }
+    }
+    for (const PopIndex x : affected_) { dist[x] = kInf; parent[x] = kNoRelay; }
+
+    // Restart each affected node from its best unaffected in-neighbour, then settle the set.
+    heap_.clear();
+    for (const PopIndex x : affected_) {
+        std::uint64_t best = kInf;
+        PopIndex via = kNoRelay;
+        for (const PopIndex p : in_[x]) {
+            if (mark_[p] || dist[p] == kInf) continue;
+            const std::uint64_t c = dist[p] + weight(p, x);
+            if (c < best) { best = c; via = p; }
+        }
+        if (via != kNoRelay) { dist[x] = best; parent[x] = via; push(best, x); }
+    }
+    for (const PopIndex x : affected_) mark_[x] = 0;
+    t.dirty = true;
+    settle(t);
+    return affected_.size();
+}
+
+void ShortestPaths::full(Tree& t) {
+    // PoP meshes are dense: O(n^2) array Dijkstra beats a heap here.
+    auto& dist = t.row.dist;
+    auto& parent = t.row.parent;
+    std::fill(dist.begin(), dist.end(), kInf);
+    std::fill(parent.begin(), parent.end(), kNoRelay);
+    dist[t.source] = 0;
+    for (std::size_t round = 0; round < n_; ++round) {
+        std::uint64_t d = kInf;
+        std::size_t x = n_;
+        for (std::size_t i = 0; i < n_; ++i) {
+            if (!mark_[i] && dist[i] < d) { d = dist[i]; x = i; }
+        }
+        if (x == n_) break;
+        mark_[x] = 1;
+        const std::uint32_t* row = &w_[x * n_];
+        for (const PopIndex y : out_[x]) {
+            const std::uint64_t nd = d + row[y];
+            if (nd < dist[y]) { dist[y] = nd; parent[y] = static_cast<PopIndex>(x); }
+        }
+    }
+    std::fill(mark_.begin(), mark_.end(), std::uint8_t{0});
+    t.dirty = true;
+}
+
+void ShortestPaths::publish(bool all) {
+    auto snap = std::make_shared<ShortestPathSnapshot>();
+    if (current_ && !all) snap->rows_ = current_->rows_;   // unchanged rows are shared
+    else snap->rows_.resize(n_);
+    for (Tree& t : trees_) {
+        if (!all && !t.dirty) continue;
+        snap->rows_[t.source] = std::make_shared<const Row>(t.row);
+        t.dirty = false;
+    }
+    snap->version_ = ++version_;
+    std::atomic_store_explicit(&current_, std::shared_ptr<const ShortestPathSnapshot>(std::move(snap)),
+                               std::memory_order_release);
+}
+
+} // namespace alpha::routing
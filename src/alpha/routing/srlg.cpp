@@ -0,0 +1,176 @@
+/**
+ * @file srlg.cpp
+ * @brief SRLG-aware backup selection and one-pass bulk switch on group failure.
+ */
+#include "alpha/routing/srlg.hpp"
+
+#include <utility>
+
+namespace alpha::routing {
+
+namespace {
+constexpr const char* kReason = "srlg_failure";
+}
+
+SrlgBackupTable::Service* SrlgBackupTable::find(std::string_view id) noexcept {
+    const auto it = index_.find(id);
+    return it == index_.end() ? nullptr : &services_[it->second];
+}
+
+const SrlgBackupTable::Service* SrlgBackupTable::find(std::string_view id) const noexcept {
+    const auto it = index_.find(id);
+    return it == index_.end() ? nullptr : &services_[it->second];
+}
+
+SrlgMask SrlgBackupTable::indexed(const Service& s) noexcept {
+    SrlgMask m = s.candidates[s.active].srlg;
+    if (s.backup != kNone) m |= s.candidates[s.backup].srlg;
+    return m;
+}
+
+std::uint32_t SrlgBackupTable::pick(const Service& s, SrlgMask avoid) const noexcept {
+    std::uint32_t best = kNone;
+    int best_shared = 0;
+    for (std::uint32_t i = 0; i < s.candidates.size(); ++i) {
+        const SrlgCandidate& c = s.candidates[i];
+        if (i == s.active || !c.usable || (c.srlg & failed_)) continue;
+        const int shared = srlg_shared(c.srlg, avoid);
+        if (best == kNone || shared < best_shared ||
+            (shared == best_shared && c.score > s.candidates[best].score)) {
+            best = i;
+            best_shared = shared;
+        }
+    }
+    return best;
+}
+
+bool SrlgBackupTable::set_service(std::string_view service_id, std::vector<SrlgCandidate> candidates,
+                                  std::string_view active) {
+    std::uint32_t a = 0;
+    while (a < candidates.size() && candidates[a].path_id != active) ++a;
+    if (a == candidates.size()) return false;
+
+    Service* s = find(service_id);
+    if (!s) {
+        index_.emplace(std::string(service_id), static_cast<std::uint32_t>(services_.size()));
+        s = &services_.emplace_back();
+        s->id = std::string(service_id);
+    }
+    s->candidates = std::move(candidates);
+    s->active = a;
+    s->backup = pick(*s, s->candidates[a].srlg);
+    stale_ = true;
+    return true;
+}
+
+bool SrlgBackupTable::remove_service(std::string_view service_id) {
+    const auto it = index_.find(service_id);
+    if (it == index_.end()) return false;
+    const std::uint32_t i = it->second;
+    index_.erase(it);
+    if (i + 1 != services_.size()) {
+        services_[i] = std::move(services_.back());
+        index_.find(services_[i].id)->second = i;
+    }
+    services_.pop_back();
+    stale_ = true;
+    return true;
+}
+
+bool SrlgBackupTable::update(std::string_view service_id, std::string_view path_id, double score, bool usable) {
+    Service* s = find(service_id);
+    if (!s) return false;
+    for (SrlgCandidate& c : s->candidates) {
+        if (c.path_id != path_id) continue;
+        c.score  = score;
+        c.usable = usable;
+        const SrlgMask before = indexed(*s);
+        s->backup = pick(*s, s->candidates[s->active].srlg);
+        stale_ |= indexed(*s) != before;
+        return true;
+    }
+    return false;
+}
+
+bool SrlgBackupTable::set_active(std::string_view service_id, std::string_view path_id) {
+    Service* s = find(service_id);
+    if (!s) return false;
+    for (std::uint32_t i = 0; i < s->candidates.size(); ++i) {
+        if (s->candidates[i].path_id != path_id) continue;
+        s->active = i;
+        s->backup = pick(*s, s->candidates[i].srlg);
+        stale_ = true;
+        return true;
+    }
+    return false;
+}
+
+void SrlgBackupTable::reindex() {
+    for (auto& g : by_group_) g.clear();
+    for (std::uint32_t i = 0; i < services_.size(); ++i) {
+        for (SrlgMask m = indexed(services_[i]); m; m &= m - 1) {
+            by_group_[static_cast<std::size_t>(std::countr_zero(m))].push_back(i);
+        }
+    }
+    stale_ = false;
+}
+
+std::vector<SrlgSwitch> SrlgBackupTable::fail_groups(SrlgMask groups) {
+    std::vector<SrlgSwitch> out;
+    const SrlgMask newly = groups & ~failed_;
+    if (!newly) return out;
+    failed_ |= newly;
+    if (stale_) reindex();
+
+    ++pass_;
+    for (SrlgMask m = newly; m; m &= m - 1) {
+        for (const std::uint32_t i : by_group_[static_cast<std::size_t>(std::countr_zero(m))]) {
+            Service& s = services_[i];
+            if (s.seen == pass_) continue;
+            s.seen = pass_;
+
+            if (s.candidates[s.active].srlg & failed_) {
+                // Precomputed backup if it survived, else the best candidate that did.
+                std::uint32_t to = s.backup;
+                if (to == kNone || (s.candidates[to].srlg & failed_)) to = pick(s, s.candidates[s.active].srlg);
+                if (to == kNone) {
+                    s.backup = kNone;
+                    out.push_back({s.id, FailoverDecision{std::string{}, kReason}});
+                    continue;
+                }
+                s.active = to;
+                s.backup = pick(s, s.candidates[to].srlg);
+                out.push_back({s.id, FailoverDecision{s.candidates[to].path_id, kReason}});
+            } else if (s.backup != kNone && (s.candidates[s.backup].srlg & failed_)) {
+                s.backup = pick(s, s.candidates[s.active].srlg);
+            }
+        }
+    }
+    stale_ = true;
+    return out;
+}
+
+void SrlgBackupTable::restore_groups(SrlgMask groups) {
+    if (!(failed_ & groups)) return;
+    failed_ &= ~groups;
+    for (Service& s : services_) s.backup = pick(s, s.candidates[s.active].srlg);
+    stale_ = true;
+}
+
+const SrlgCandidate* SrlgBackupTable::active(std::string_view service_id) const noexcept {
+    const Service* s = find(service_id);
+    return s ? &s->candidates[s->active] : nullptr;
+}
+
+const SrlgCandidate* SrlgBackupTable::backup(std::string_view service_id) const noexcept {
+    const Service* s = find(service_id);
+    return (s && s->backup != kNone) ? &s->candidates[s->backup] : nullptr;
+}
+
+std::size_t SrlgBackupTable::exposed(SrlgMask groups) const noexcept {
+    std::size_t n = 0;
+    for (const Service& s : services_) n += (s.candidates[s.active].srlg & groups) ? 1u : 0u;
+    return n;
+}
+
+} // namespace alpha::routing
@@ -0,0 +1,151 @@
+/**
+ * @file switch_scheduler.cpp
+ * @brief Priority admission of queued failover switches and per-tick active-path publication.
+ */
+#include "alpha/routing/switch_scheduler.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+
+namespace alpha::routing {
+
+SwitchScheduler::SwitchScheduler(SwitchBudgetConfig cfg)
+: cfg_(cfg) {
+    publish();
+}
+
+void SwitchScheduler::set_active(std::string_view service_id, std::string_view path_id) {
+    const auto it = active_.find(service_id);
+    if (it == active_.end()) active_.emplace(std::string(service_id), std::string(path_id));
+    else if (it->second != path_id) it->second = std::string(path_id);
+    else return;
+    dirty_ = true;
+
+    // A queued switch to the path now active is done.
+    const auto q = queued_.find(service_id);
+    if (q != queued_.end() && queue_[q->second].req.decision.next_path_id == path_id) cancel(service_id);
+}
+
+void SwitchScheduler::remove(std::string_view service_id) {
+    const auto it = active_.find(service_id);
+    if (it != active_.end()) {
+        active_.erase(it);
+        dirty_ = true;
+    }
+    cancel(service_id);
+}
+
+bool SwitchScheduler::submit(SwitchRequest r) {
+    const std::string& next = r.decision.next_path_id;
+    if (next.empty()) return false;
+    const auto a = active_.find(r.service_id);
+    if (a != active_.end() && a->second == next) {
+        cancel(r.service_id);   // already there: a queued older decision is obsolete
+        return false;
+    }
+    const auto q = queued_.find(r.service_id);
+    if (q != queued_.end()) {
+        queue_[q->second].req = std::move(r);   // latest decision, original place in line
+        return true;
+    }
+    queued_.emplace(r.service_id, queue_.size());
+    queue_.push_back({std::move(r), seq_++});
+    return true;
+}
+
+bool SwitchScheduler::cancel(std::string_view service_id) {
+    const auto q = queued_.find(service_id);
+    if (q == queued_.end()) return false;
+    const std::size_t i = q->second;
+    queued_.erase(q);
+    if (i + 1 != queue_.size()) {
+        queue_[i] = std::move(queue_.back());
+        queued_.find(queue_[i].req.service_id)->second = i;
+    }
+    queue_.pop_back();
+    return true;
+}
+
+void SwitchScheduler::set_path_state(std::string_view path_id, HealthState s) {
+    const auto it = down_.find(path_id);
+    if (s == HealthState::Down) {
+        if (it == down_.end()) down_.emplace(path_id);
+    } else if (it != down_.end()) {
+        down_.erase(it);
+    }
+}
+
+SwitchBatch SwitchScheduler::tick() {
+    SwitchBatch out;
+    if (!queue_.empty()) {
+        std::vector<std::size_t> order(queue_.size());
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::sort(order.begin(), order.end(), [this](std::size_t x, std::size_t y) {
+            const Queued& a = queue_[x];
+            const Queued& b = queue_[y];
+            if (a.req.current_down != b.req.current_down) return a.req.current_down;
+            if (a.req.qos_class != b.req.qos_class) return a.req.qos_class > b.req.qos_class;
+            return a.seq < b.seq;
+        });
+
+        const std::size_t budget = cfg_.max_switches_per_tick ? cfg_.max_switches_per_tick : queue_.size();
+        std::unordered_map<std::string_view, std::uint32_t> per_target;
+        // admit[i]: 0 = defer, 1 = apply, 2 = drop (target went Down while queued).
+        std::vector<std::uint8_t> admit(queue_.size(), 0);
+        std::size_t admitted = 0;
+        for (const std::size_t i : order) {
+            if (down_.count(queue_[i].req.decision.next_path_id)) { admit[i] = 2; continue; }
+            if (admitted == budget) continue;
+            if (cfg_.max_per_target) {
+                std::uint32_t& n = per_target[queue_[i].req.decision.next_path_id];
+                if (n == cfg_.max_per_target) continue;   // herd onto this path: wait a tick
+                ++n;
+            }
+            admit[i] = 1;
+            ++admitted;
+        }
+
+        out.applied.reserve(admitted);
+        for (const std::size_t i : order) {
+            if (admit[i] == 2) out.dropped.push_back(std::move(queue_[i].req));
+            if (admit[i] != 1) continue;
+            SwitchRequest& r = queue_[i].req;
+            const auto a = active_.find(r.service_id);
+            if (a == active_.end()) active_.emplace(r.service_id, r.decision.next_path_id);
+            else a->second = r.decision.next_path_id;
+            out.applied.push_back(std::move(r));
+        }
+
+        // Keep the deferred ones (and their place in line).
+        std::size_t w = 0;
+        for (std::size_t i = 0; i < queue_.size(); ++i) {
+            if (admit[i]) continue;
+            if (w != i) queue_[w] = std::move(queue_[i]);
+            ++w;
+        }
+        queue_.resize(w);
+        queued_.clear();
+        for (std::size_t i = 0; i < queue_.size(); ++i) queued_.emplace(queue_[i].req.service_id, i);
+        dirty_ |= admitted != 0;
+    }
+
+    if (dirty_) {
+        ++generation_;
+        publish();
+        dirty_ = false;
+    }
+    out.deferred   = queue_.size();
+    out.generation = generation_;
+    return out;
+}
+
+void SwitchScheduler::publish() {
+    auto t = std::make_shared<ActivePathTable>();
+    t->paths_      = active_;
+    t->generation_ = generation_;
+    std::shared_ptr<const ActivePathTable> ct = std::move(t);
+    std::atomic_store_explicit(&current_, std::move(ct), std::memory_order_release);
+}
+
+} // namespace alpha::routing
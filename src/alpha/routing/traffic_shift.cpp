@@ -0,0 +1,126 @@
+/**
+ * @file traffic_shift.cpp
+ * @brief Gated step ramps for per-service traffic splits and their coalesced publication.
+ */
+#include "alpha/routing/traffic_shift.hpp"
+
+#include <algorithm>
+
+namespace alpha::routing {
+
+ShiftController::ShiftController(std::size_t services, ShiftConfig cfg)
+: cfg_(cfg) {
+    cfg_.step_ppm = std::clamp<std::uint32_t>(cfg_.step_ppm, 1, kShiftFullPpm);
+    resize(services);
+}
+
+void ShiftController::resize(std::size_t services) {
+    splits_.resize(services);
+    state_.resize(services, ShiftState::Idle);
+    step_.resize(services, cfg_.step_ppm);
+    target_.resize(services, kInvalidPath);
+    last_.resize(services);
+    std::erase_if(ramping_, [services](ServiceHandle h) { return h >= services; });
+    publish();
+}
+
+void ShiftController::remap(const ServiceIndex& before, const ServiceIndex& after) {
+    const std::size_t n = after.size();
+    std::vector<TrafficSplit>      splits(n);
+    std::vector<ShiftState>        state(n, ShiftState::Idle);
+    std::vector<std::uint32_t>     step(n, cfg_.step_ppm);
+    std::vector<PathId>            target(n, kInvalidPath);
+    std::vector<Clock::time_point> last(n);
+
+    const std::size_t old = std::min(before.size(), splits_.size());
+    for (ServiceHandle h = 0; h < old; ++h) {
+        if (state_[h] == ShiftState::Idle && !splits_[h].active()) continue;
+        const ServiceHandle to = after.find(before.id(h));
+        if (to == kInvalidService) continue;
+        splits[to] = splits_[h];
+        state[to]  = state_[h];
+        step[to]   = step_[h];
+        target[to] = target_[h];
+        last[to]   = last_[h];
+    }
+    for (ServiceHandle& h : ramping_) h = h < old ? after.find(before.id(h)) : kInvalidService;
+    std::erase(ramping_, kInvalidService);
+
+    splits_ = std::move(splits);
+    state_  = std::move(state);
+    step_   = std::move(step);
+    target_ = std::move(target);
+    last_   = std::move(last);
+    publish();
+}
+
+bool ShiftController::begin(ServiceHandle h, PathId from, PathId to, Clock::time_point now, std::uint32_t step_ppm) {
+    if (h >= splits_.size() || from == to || to == kInvalidPath) return false;
+    TrafficSplit& s = splits_[h];
+    if (!(s.active() && s.from == to && s.to == from)) s = TrafficSplit{from, to, 0};
+    target_[h] = to;
+    step_[h]   = step_ppm ? std::min(step_ppm, kShiftFullPpm) : cfg_.step_ppm;
+    last_[h]   = now;
+    if (state_[h] != ShiftState::Ramping) ramping_.push_back(h);
+    state_[h] = ShiftState::Ramping;
+    return true;
+}
+
+void ShiftController::release(ServiceHandle h) {
+    if (h >= splits_.size()) return;
+    splits_[h] = TrafficSplit{};
+    state_[h]  = ShiftState::Idle;
+    target_[h] = kInvalidPath;
+    std::erase(ramping_, h);
+    publish();
+}
+
+bool ShiftController::gate(std::span<const MetricsSlot> slots, PathId p) const noexcept {
+    if (p >= slots.size()) return false;
+    PathMetrics m{};
+    if (!dp::load_metrics(slots[p], m)) return false;
+    return m.healthy && m.rtt_us <= cfg_.max_rtt_us && m.loss_ppm <= cfg_.max_loss_ppm;
+}
+
+std::size_t ShiftController::tick(std::span<const MetricsSlot> slots, Clock::time_point now,
+                                  std::vector<ShiftEvent>* events) {
+    const auto hold = std::chrono::milliseconds(cfg_.step_hold_ms);
+    std::size_t changed = 0;
+    for (std::size_t i = 0; i < ramping_.size();) {
+        const ServiceHandle h = ramping_[i];
+        TrafficSplit& s = splits_[h];
+        const bool up = target_[h] == s.to;   // reversed shifts ramp the same split down
+        ShiftState done = ShiftState::Ramping;
+
+        if (!gate(slots, target_[h])) {
+            s.to_ppm = up ? 0 : kShiftFullPpm;   // everything back on the source
+            done = ShiftState::Aborted;
+            ++changed;
+        } else if (now - last_[h] >= hold) {
+            const std::uint32_t st = step_[h];
+            s.to_ppm = up ? std::min(kShiftFullPpm, s.to_ppm + st) : (s.to_ppm > st ? s.to_ppm - st : 0);
+            last_[h] = now;
+            if (s.to_ppm == (up ? kShiftFullPpm : 0)) done = ShiftState::Complete;
+            ++changed;
+        }
+
+        if (done == ShiftState::Ramping) { ++i; continue; }
+        // Settled: everything is on one path, which the caller now owns; drop the split.
+        const PathId settled = done == ShiftState::Complete ? target_[h] : (up ? s.from : s.to);
+        state_[h] = done;
+        if (events) events->push_back({h, done, s.to_ppm, settled});
+        s = TrafficSplit{};
+        target_[h] = kInvalidPath;
+        ramping_[i] = ramping_.back();
+        ramping_.pop_back();
+    }
+    if (changed != 0) publish();
+    return changed;
+}
+
+void ShiftController::publish() {
+    std::shared_ptr<const SplitTable> t = std::make_shared<const SplitTable>(splits_);
+    std::atomic_store_explicit(&current_, std::move(t), std::memory_order_release);
+}
+
+} // namespace alpha::routing
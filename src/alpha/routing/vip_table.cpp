@@ -0,0 +1,128 @@
+/**
+ * @file vip_table.cpp
+ * @brief Hash-and-displace construction and burst lookups for VipTable; VipResolver refresh.
+ */
+#include "alpha/routing/vip_table.hpp"
+#include "alpha/mem/prefetch.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace alpha::routing {
+
+namespace {
+constexpr std::uint32_t kMaxDisplacement = 1u << 16;  ///< Tries per bucket before growing the table
+constexpr int           kMaxAttempts     = 8;         ///< Seeds/sizes tried before BuildFailed
+} // namespace
+
+alpha_detail::expected<std::shared_ptr<const VipTable>, VipError>
+VipTable::compile(std::span<const VipBinding> bindings, std::shared_ptr<const ServiceIndex> index) {
+    std::shared_ptr<VipTable> t(new VipTable());
+    t->index_ = std::move(index);
+    if (!t->index_) t->index_ = ServiceIndex::compile(nullptr, 0);
+
+    struct Item { std::uint64_t key; ServiceHandle handle; };
+    std::vector<Item> items;
+    items.reserve(bindings.size());
+    for (const auto& b : bindings) {
+        const ServiceHandle h = t->index_->find(b.service_id);
+        if (h == kInvalidService) { ++t->unresolved_; continue; }
+        items.push_back({pack(b.vip, b.port, b.proto), h});
+        t->any_port_ = t->any_port_ || b.port == 0;
+    }
+    std::sort(items.begin(), items.end(), [](const Item& a, const Item& b) { return a.key < b.key; });
+    if (std::adjacent_find(items.begin(), items.end(),
+                           [](const Item& a, const Item& b) { return a.key == b.key; }) != items.end())
+        return alpha_detail::unexpected(VipError::Duplicate);
+
+    const std::size_t n = items.size();
+    t->size_ = n;
+    std::vector<std::uint64_t> hs(n);
+    std::vector<std::vector<std::uint32_t>> buckets;
+    std::vector<std::size_t> order, taken;
+    std::vector<bool> used;
+
+    for (int attempt = 0; attempt < kMaxAttempts; ++attempt) {
+        t->seed_ = mix(std::uint64_t{0x5EED0000} + static_cast<std::uint64_t>(attempt));
+        // ~4 keys per bucket, load factor ~0.8 (grows on retry).
+        t->disp_.assign(std::max<std::size_t>(1, (n + 3) / 4), 0);
+        t->slots_.assign(std::max<std::size_t>(1, n + n / 4 + static_cast<std::size_t>(attempt) * (n / 8) + 1), Slot{});
+
+        buckets.assign(t->disp_.size(), {});
+        for (std::uint32_t i = 0; i < n; ++i) {
+            hs[i] = mix(items[i].key ^ t->seed_);
+            buckets[t->bucket_of(hs[i])].push_back(i);
+        }
+        // Largest buckets first: they are the hardest to place.
+        order.resize(buckets.size());
+        std::iota(order.begin(), order.end(), std::size_t{0});
+        std::sort(order.begin(), order.end(),
+                  [&](std::size_t a, std::size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+        used.assign(t->slots_.size(), false);
+        bool ok = true;
+        for (const std::size_t bi : order) {
+            const auto& keys = buckets[bi];
+            if (keys.empty()) break;
+            bool placed = false;
+            for (std::uint32_t d = 0; d < kMaxDisplacement && !placed; ++d) {
+                taken.clear();
+                for (const auto i : keys) {
+                    const std::size_t s = t->slot_of(hs[i], d);
+                    if (used[s] || std::find(taken.begin(), taken.end(), s) != taken.end()) break;
+                    taken.push_back(s);
+                }
+                if (taken.size() != keys.size()) continue;
+                for (std::size_t j = 0; j < keys.size(); ++j) {
+                    used[taken[j]] = true;
+                    t->slots_[taken[j]] = Slot{items[keys[j]].key, items[keys[j]].handle, 0};
+                }
+                t->disp_[bi] = d;
+                placed = true;
+            }
+            if (!placed) { ok = false; break; }
+        }
+        if (ok) return std::shared_ptr<const VipTable>(std::move(t));
+    }
+    return alpha_detail::unexpected(VipError::BuildFailed);
+}
+
+void VipTable::find_burst(std::span<const VipKey> keys, std::span<ServiceHandle> out) const noexcept {
+    std::uint64_t ks[kPrefetchGroup];
+    std::size_t   ss[kPrefetchGroup];
+    for (std::size_t base = 0; base < keys.size(); base += kPrefetchGroup) {
+        const std::size_t n = std::min(kPrefetchGroup, keys.size() - base);
+        // Stage 1: hash, resolve the displacement and prefetch every slot.
+        for (std::size_t i = 0; i < n; ++i) {
+            const VipKey& k = keys[base + i];
+            ks[i] = pack(k.vip, k.port, k.proto);
+            const std::uint64_t h = mix(ks[i] ^ seed_);
+            ss[i] = slot_of(h, disp_[bucket_of(h)]);
+            alpha::mem::prefetch_read(&slots_[ss[i]]);
+        }
+        // Stage 2: compare (any-port fallback only on a miss).
+        for (std::size_t i = 0; i < n; ++i) {
+            const Slot& s = slots_[ss[i]];
+            out[base + i] = s.key == ks[i] ? s.handle : (any_port_ ? find(keys[base + i]) : kInvalidService);
+        }
+    }
+}
+
+VipResolver::VipResolver() : current_(*VipTable::compile({}, nullptr)) {}
+
+void VipResolver::set_bindings(std::vector<VipBinding> bindings) {
+    bindings_ = std::move(bindings);
+    dirty_ = true;
+}
+
+alpha_detail::expected<bool, VipError> VipResolver::refresh(const ServiceRegistry& reg) {
+    // Single control-plane writer: current_ can be read without the atomic load.
+    if (!dirty_ && current_->index().version() == reg.version()) return false;
+    auto next = VipTable::compile(bindings_, ServiceIndex::compile(reg));
+    if (!next) return alpha_detail::unexpected(next.error());
+    std::atomic_store_explicit(&current_, std::move(*next), std::memory_order_release);
+    dirty_ = false;
+    return true;
+}
+
+} // namespace alpha::routing
@@ -1,17 +1,420 @@
-// ============================================================================
-// Alpha Smart Router — Unit Test Placeholder
-// ----------------------------------------------------------------------------
-// This file is a placeholder for future unit tests.
-//
-// Scope: Failover Policy
-// Planned Milestone: v0.2.0
-//
-// TODOs:
-//  - Add tests for failover switching when current path becomes unhealthy
-//  - Validate hold timer and "return-to-primary" behavior
-//  - Verify decision reason codes match expected outcomes
-//  - Integrate with verification plan in docs/
-//
-// Note: This placeholder exists to communicate testing roadmap and ensure
-//       consistency with the CHANGELOG and documentation.
-// ============================================================================
+/**
+ * @file test_failover.cpp
+ * @brief Tests for FailoverPolicy and shared-risk-group aware backups.
+ *
+ * Validates:
+ *  - Switch on current Down, preferring a backup that shares no risk group
+ *  - Hysteresis margin and return-to-primary decisions
+ *  - SrlgBackupTable precomputed backups and one-pass bulk switch on group failure
+ *  - SwitchScheduler budget, priority order, deferral and one publish per tick
+ *  - SwitchScheduler drops deferred switches onto backups that went Down
+ *  - Damped-trend forecasts and pre-emptive switching on predicted scores
+ *  - CUSUM / Page-Hinkley change points on relative shifts and their service fan-out
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "alpha/routing/change_point.hpp"
+#include "alpha/routing/failover_policy.hpp"
+#include "alpha/routing/forecast.hpp"
+#include "alpha/routing/srlg.hpp"
+#include "alpha/routing/switch_scheduler.hpp"
+
+using alpha::routing::FailoverConfig;
+using alpha::routing::FailoverPolicy;
+using alpha::routing::HealthState;
+using alpha::routing::PathHealth;
+using alpha::routing::QoSScore;
+using alpha::routing::srlg_bit;
+
+namespace {
+using Clock = std::chrono::steady_clock;
+
+QoSScore score(std::string id, double s) {
+  QoSScore q{};
+  q.path_id = std::move(id);
+  q.score = s;
+  return q;
+}
+} // namespace
+
+/**
+ * @test Failover_CurrentDown_PrefersSrlgDisjoint
+ * @brief With current Down the best candidate wins, unless it shares a risk group with current
+ *        and a disjoint healthy one exists; the margin and return-to-primary paths are unchanged.
+ */
+TEST(Failover, CurrentDown_PrefersSrlgDisjoint) {
+  FailoverConfig cfg;
+  cfg.primary_path_id = "p";
+  FailoverPolicy pol{cfg};
+  const auto now = Clock::now();
+
+  // p and b1 ride the same transit (group 3); b2 is on another provider.
+  const std::vector<QoSScore> sc{score("p", 0.9), score("b1", 0.8), score("b2", 0.6)};
+  std::vector<PathHealth> h{
+    {.path_id="p",  .state=HealthState::Down, .last_change={}, .srlg=srlg_bit(3)},
+    {.path_id="b1", .state=HealthState::Up,   .last_change={}, .srlg=srlg_bit(3) | srlg_bit(7)},
+    {.path_id="b2", .state=HealthState::Up,   .last_change={}, .srlg=srlg_bit(9)},
+  };
+  auto d = pol.evaluate("p", sc, h, now);
+  ASSERT_TRUE(d.has_value());
+  EXPECT_EQ(d->next_path_id, "b2");
+  EXPECT_EQ(d->reason, "current_down_srlg_disjoint");
+
+  // Disabled, or no disjoint candidate left: plain best.
+  cfg.prefer_srlg_disjoint = false;
+  pol.update_config(cfg);
+  EXPECT_EQ(pol.evaluate("p", sc, h, now)->next_path_id, "b1");
+  cfg.prefer_srlg_disjoint = true;
+  pol.update_config(cfg);
+  h[2].state = HealthState::Down;
+  d = pol.evaluate("p", sc, h, now);
+  ASSERT_TRUE(d.has_value());
+  EXPECT_EQ(d->next_path_id, "b1");
+  EXPECT_EQ(d->reason, "current_down");
+
+  // On b1 with the primary back: margin not met, so return-to-primary after the recovery hold.
+  h[0].state = HealthState::Up;
+  h[0].last_change = now;
+  EXPECT_FALSE(pol.evaluate("b1", {score("p", 0.85), score("b1", 0.8)}, h, now).has_value());
+  d = pol.evaluate("b1", {score("p", 0.85), score("b1", 0.8)}, h,
+                   now + std::chrono::milliseconds(cfg.recovery_hold_ms));
+  ASSERT_TRUE(d.has_value());
+  EXPECT_EQ(d->reason, "return_to_primary");
+  EXPECT_EQ(d->step_ppm, 0u);   // all at once unless a ramp is configured
+  cfg.return_step_ppm = 200'000;
+  pol.update_config(cfg);
+  d = pol.evaluate("b1", {score("p", 0.85), score("b1", 0.8)}, h,
+                   now + std::chrono::milliseconds(cfg.recovery_hold_ms));
+  ASSERT_TRUE(d.has_value());
+  EXPECT_EQ(d->step_ppm, 200'000u);
+}
+
+/**
+ * @test Srlg_BackupTable_BulkSwitch
+ * @brief Backups avoid the active path's groups; a group failure moves exactly the exposed
+ *        services in one call, re-picks backups that were hit, and restore re-enables them.
+ */
+TEST(Failover, Srlg_BackupTable_BulkSwitch) {
+  using alpha::routing::SrlgBackupTable;
+  using alpha::routing::SrlgCandidate;
+  const auto fibre = srlg_bit(1), transit_a = srlg_bit(2), transit_b = srlg_bit(3);
+
+  SrlgBackupTable t;
+  // Best-scoring backup shares the fibre with the primary: the disjoint one is precomputed.
+  ASSERT_TRUE(t.set_service("web", {{"w1", fibre | transit_a, 0.9}, {"w2", fibre | transit_b, 0.8},
+                                    {"w3", transit_b, 0.5}}, "w1"));
+  // Active path off the fibre; its backup is on it.
+  ASSERT_TRUE(t.set_service("api", {{"a1", transit_b, 0.9}, {"a2", fibre, 0.7}}, "a1"));
+  // Nothing disjoint: least overlap wins.
+  ASSERT_TRUE(t.set_service("db", {{"d1", fibre | transit_a, 0.9}, {"d2", fibre, 0.8},
+                                   {"d3", fibre | transit_a, 0.95}}, "d1"));
+  EXPECT_FALSE(t.set_service("bad", {{"x", 0, 1.0}}, "y"));
+  EXPECT_EQ(t.size(), 3u);
+  EXPECT_EQ(t.backup("web")->path_id, "w3");
+  EXPECT_EQ(t.backup("api")->path_id, "a2");
+  EXPECT_EQ(t.backup("db")->path_id, "d2");
+  EXPECT_EQ(t.exposed(fibre), 2u);
+
+  // Fibre cut: web → w3 (precomputed), db has nothing left off the fibre; api only loses its backup.
+  const auto sw = t.fail_groups(fibre);
+  ASSERT_EQ(sw.size(), 2u);
+  for (const auto& s : sw) {
+    EXPECT_EQ(s.decision.reason, "srlg_failure");
+    if (s.service_id == "web") {
+      EXPECT_EQ(s.decision.next_path_id, "w3");
+    } else {
+      EXPECT_EQ(s.service_id, "db");
+      EXPECT_TRUE(s.decision.next_path_id.empty());
+    }
+  }
+  EXPECT_EQ(t.active("web")->path_id, "w3");
+  EXPECT_EQ(t.active("api")->path_id, "a1");
+  EXPECT_EQ(t.backup("api"), nullptr);
+  EXPECT_EQ(t.backup("web"), nullptr);   // w1, w2 both on the fibre
+  EXPECT_EQ(t.exposed(fibre), 1u);
+  EXPECT_TRUE(t.fail_groups(fibre).empty());  // already failed: no-op
+
+  // A second failure is indexed on the new actives.
+  const auto sw2 = t.fail_groups(transit_b);
+  ASSERT_EQ(sw2.size(), 2u);   // web (w3) and api (a1), neither with a survivor
+  EXPECT_EQ(t.failed(), fibre | transit_b);
+
+  t.restore_groups(fibre | transit_b);
+  EXPECT_EQ(t.failed(), 0u);
+  EXPECT_EQ(t.backup("web")->path_id, "w1");   // disjoint from w3 (transit_b)
+  ASSERT_TRUE(t.update("web", "w1", 0.9, false));
+  EXPECT_EQ(t.backup("web")->path_id, "w2");
+  ASSERT_TRUE(t.set_active("api", "a2"));
+  EXPECT_EQ(t.backup("api")->path_id, "a1");
+  EXPECT_TRUE(t.remove_service("api"));
+  EXPECT_EQ(t.active("api"), nullptr);
+  EXPECT_EQ(t.active("db")->path_id, "d1");
+  EXPECT_EQ(t.exposed(fibre), 1u);
+}
+
+/**
+ * @test SwitchScheduler_Budget_Priority
+ * @brief Down services go first, then higher classes, then FIFO; the rest wait with their place
+ *        kept; each tick publishes at most one generation; per-target caps spread a herd.
+ */
+TEST(Failover, SwitchScheduler_Budget_Priority) {
+  using alpha::routing::QoSClass;
+  using alpha::routing::SwitchRequest;
+  using alpha::routing::SwitchScheduler;
+  auto req = [](std::string svc, std::string next, QoSClass c, bool down) {
+    SwitchRequest r;
+    r.service_id = std::move(svc);
+    r.decision.next_path_id = std::move(next);
+    r.decision.reason = down ? "current_down" : "better_candidate_with_margin";
+    r.qos_class = c;
+    r.current_down = down;
+    return r;
+  };
+
+  SwitchScheduler sch({.max_switches_per_tick = 2, .max_per_target = 0});
+  for (const char* s : {"s0", "s1", "s2", "s3", "s4"}) sch.set_active(s, "p");
+  EXPECT_EQ(sch.tick().generation, 1u);
+  EXPECT_EQ(sch.current()->size(), 5u);
+
+  EXPECT_TRUE(sch.submit(req("s0", "b1", QoSClass::BestEffort, false)));
+  EXPECT_TRUE(sch.submit(req("s1", "b1", QoSClass::Realtime, false)));
+  EXPECT_TRUE(sch.submit(req("s2", "b2", QoSClass::Bulk, true)));
+  EXPECT_TRUE(sch.submit(req("s3", "b1", QoSClass::BestEffort, true)));
+  EXPECT_TRUE(sch.submit(req("s4", "b2", QoSClass::Realtime, true)));
+  EXPECT_FALSE(sch.submit(req("s4", "", QoSClass::Realtime, true)));
+
+  auto b = sch.tick();
+  ASSERT_EQ(b.applied.size(), 2u);
+  EXPECT_EQ(b.applied[0].service_id, "s4");
+  EXPECT_EQ(b.applied[1].service_id, "s3");
+  EXPECT_EQ(b.deferred, 3u);
+  EXPECT_EQ(b.generation, 2u);
+  const auto snap = sch.current();
+  EXPECT_EQ(snap->path_of("s4"), "b2");
+  EXPECT_EQ(snap->path_of("s2"), "p");
+
+  // Resubmitting keeps the place in line; a decision for the active path drops the queued one.
+  EXPECT_TRUE(sch.submit(req("s2", "b3", QoSClass::Bulk, true)));
+  EXPECT_FALSE(sch.submit(req("s0", "p", QoSClass::BestEffort, false)));
+  EXPECT_EQ(sch.pending(), 2u);
+  b = sch.tick();
+  ASSERT_EQ(b.applied.size(), 2u);
+  EXPECT_EQ(b.applied[0].service_id, "s2");
+  EXPECT_EQ(b.applied[0].decision.next_path_id, "b3");
+  EXPECT_EQ(b.applied[1].service_id, "s1");
+  EXPECT_EQ(b.deferred, 0u);
+  EXPECT_EQ(b.generation, 3u);
+  EXPECT_EQ(snap->path_of("s2"), "p");            // old readers keep their generation
+  EXPECT_EQ(sch.current()->path_of("s2"), "b3");
+  EXPECT_EQ(sch.tick().generation, 3u);           // nothing changed: no publish
+
+  // Per-target cap: a herd onto b9 trickles in one per tick, others are not held back.
+  sch.update_config({.max_switches_per_tick = 0, .max_per_target = 1});
+  for (const char* s : {"s0", "s1", "s2"}) EXPECT_TRUE(sch.submit(req(s, "b9", QoSClass::Realtime, true)));
+  EXPECT_TRUE(sch.submit(req("s3", "b8", QoSClass::Bulk, false)));
+  b = sch.tick();
+  ASSERT_EQ(b.applied.size(), 2u);
+  EXPECT_EQ(b.applied[0].service_id, "s0");
+  EXPECT_EQ(b.applied[1].service_id, "s3");
+  EXPECT_EQ(b.deferred, 2u);
+  EXPECT_TRUE(sch.cancel("s1"));
+  EXPECT_FALSE(sch.cancel("s1"));
+  sch.remove("s2");
+  b = sch.tick();
+  EXPECT_TRUE(b.applied.empty());
+  EXPECT_EQ(b.deferred, 0u);
+  EXPECT_EQ(sch.current()->size(), 4u);
+  EXPECT_EQ(sch.current()->path_of("s2"), "");
+}
+
+/**
+ * @test SwitchScheduler_DropsStaleTargets
+ * @brief A deferred switch whose backup went Down while it waited is dropped at admission,
+ *        not published, and does not use budget; a recovered backup is admitted again.
+ */
+TEST(Failover, SwitchScheduler_DropsStaleTargets) {
+  using alpha::routing::HealthState;
+  using alpha::routing::SwitchRequest;
+  using alpha::routing::SwitchScheduler;
+  auto req = [](std::string svc, std::string next) {
+    SwitchRequest r;
+    r.service_id = std::move(svc);
+    r.decision.next_path_id = std::move(next);
+    r.current_down = true;
+    return r;
+  };
+
+  SwitchScheduler sch({.max_switches_per_tick = 1, .max_per_target = 0});
+  for (const char* s : {"s0", "s1", "s2"}) sch.set_active(s, "p");
+  const auto gen = sch.tick().generation;
+  for (const char* s : {"s0", "s1", "s2"}) ASSERT_TRUE(sch.submit(req(s, s[1] == '2' ? "b2" : "b1")));
+
+  auto b = sch.tick();
+  ASSERT_EQ(b.applied.size(), 1u);
+  EXPECT_EQ(b.applied[0].service_id, "s0");
+  EXPECT_EQ(b.deferred, 2u);
+
+  // b1 fails while s1 waits: s1 is dropped, and s2 gets this tick's slot.
+  sch.set_path_state("b1", HealthState::Down);
+  b = sch.tick();
+  ASSERT_EQ(b.dropped.size(), 1u);
+  EXPECT_EQ(b.dropped[0].service_id, "s1");
+  ASSERT_EQ(b.applied.size(), 1u);
+  EXPECT_EQ(b.applied[0].service_id, "s2");
+  EXPECT_EQ(b.deferred, 0u);
+  EXPECT_EQ(sch.current()->path_of("s1"), "p");
+  EXPECT_EQ(b.generation, gen + 2);
+
+  // Only Down counts; once b1 is back a new decision onto it goes through.
+  sch.set_path_state("b1", HealthState::Degraded);
+  ASSERT_TRUE(sch.submit(req("s1", "b1")));
+  b = sch.tick();
+  EXPECT_TRUE(b.dropped.empty());
+  ASSERT_EQ(b.applied.size(), 1u);
+  EXPECT_EQ(sch.current()->path_of("s1"), "b1");
+}
+
+/**
+ * @test Forecast_Trend_And_Preemption
+ * @brief A rising RTT series is extrapolated (bounded by damping), batch and per-path updates agree,
+ *        and a path still within targets today is left when its forecast is not.
+ */
+TEST(Failover, Forecast_Trend_And_Preemption) {
+  using alpha::routing::MetricForecaster;
+  using alpha::routing::QoSClass;
+
+  MetricForecaster batch(2), single(2);
+  float last = 0.0f;
+  for (int t = 0; t < 40; ++t) {
+    last = 10'000.0f + 400.0f * static_cast<float>(t);
+    const std::vector<float> rtt{last, 10'000.0f}, loss{0.001f, 0.0f};
+    batch.update(rtt, loss);
+    single.update(0, rtt[0], loss[0]);
+    single.update(1, rtt[1], loss[1]);
+  }
+  for (std::size_t p = 0; p < 2; ++p) {
+    EXPECT_FLOAT_EQ(batch.rtt_us(p, 6), single.rtt_us(p, 6));
+    EXPECT_FLOAT_EQ(batch.loss(p, 6), single.loss(p, 6));
+  }
+  EXPECT_EQ(batch.horizon(3000), 6u);
+  EXPECT_GT(batch.rtt_trend(0), 0.0f);
+  const float ahead = batch.rtt_us(0, batch.horizon(3000));
+  EXPECT_GT(ahead, last);
+  EXPECT_LT(ahead, last + 400.0f * 6.0f);
+  EXPECT_LT(batch.rtt_us(0, 1000), last + 400.0f * 10.0f);   // damped: no runaway extrapolation
+  EXPECT_NEAR(batch.rtt_us(1, 6), 10'000.0f, 1.0f);
+  EXPECT_NEAR(batch.loss(0, 6), 0.001f, 1e-5f);
+  std::vector<float> r(2), l(2);
+  batch.predict(6, r, l);
+  EXPECT_FLOAT_EQ(r[0], batch.rtt_us(0, 6));
+
+  // Target between today's RTT and the forecast: compliant now, breached within the hold period.
+  alpha::routing::QoSConfig qc;
+  qc.thresholds_by_class[QoSClass::Realtime] = {static_cast<std::uint32_t>((last + ahead) / 2.0f), 5'000, 0.01};
+  const alpha::routing::QoSPolicy qos{qc};
+  alpha::routing::PathMetrics p0{"p0", static_cast<std::uint32_t>(last), 1'000, 0.001};
+  alpha::routing::PathMetrics p1{"p1", 10'000, 1'000, 0.0};
+  const std::vector<QoSScore> now_sc{qos.score_path(p0, QoSClass::Realtime), qos.score_path(p1, QoSClass::Realtime)};
+  const std::uint32_t h = batch.horizon(FailoverConfig{}.min_hold_ms);
+  const std::vector<QoSScore> pred{qos.score_path(p0, QoSClass::Realtime, batch, 0, h),
+                                   qos.score_path(p1, QoSClass::Realtime, batch, 1, h)};
+  EXPECT_TRUE(now_sc[0].within_thresholds);
+  EXPECT_FALSE(pred[0].within_thresholds);
+  EXPECT_TRUE(pred[1].within_thresholds);
+
+  FailoverPolicy pol{FailoverConfig{}};
+  const std::vector<PathHealth> health{{.path_id="p0"}, {.path_id="p1"}};
+  const auto t0 = Clock::now();
+  EXPECT_FALSE(pol.evaluate("p0", now_sc, health, t0).has_value());
+  const auto d = pol.evaluate("p0", now_sc, pred, health, t0);
+  ASSERT_TRUE(d.has_value());
+  EXPECT_EQ(d->next_path_id, "p1");
+  EXPECT_EQ(d->reason, "predicted_degradation");
+
+  FailoverConfig off;
+  off.preempt_on_forecast = false;
+  EXPECT_FALSE(FailoverPolicy{off}.evaluate("p0", now_sc, pred, health, t0).has_value());
+}
+
+/**
+ * @test ChangePoint_RelativeShift_And_Fanout
+ * @brief A 2 ms → 3 ms RTT step (far below any absolute threshold) and a loss onset fire within a
+ *        few samples under both methods, noise does not, a shift is reported once, the return
+ *        fires as a decrease, and only services on the changed paths are re-evaluated.
+ */
+TEST(Failover, ChangePoint_RelativeShift_And_Fanout) {
+  using alpha::routing::ChangeDetectorBank;
+  using alpha::routing::ChangeEvent;
+  using alpha::routing::ChangeMethod;
+  using alpha::routing::PathMetric;
+  using alpha::routing::default_change_config;
+
+  for (const ChangeMethod method : {ChangeMethod::Cusum, ChangeMethod::PageHinkley}) {
+    auto rc = default_change_config(PathMetric::Rtt);
+    auto lc = default_change_config(PathMetric::Loss);
+    rc.method = lc.method = method;
+    ChangeDetectorBank bank(3, rc, lc);
+    std::vector<ChangeEvent> ev;
+    auto noise = [](int t) { return static_cast<float>((t * 37) % 11 - 5) * 8.0f; };   // ±40 us
+
+    int t = 0;
+    for (; t < 60; ++t) {
+      const std::vector<float> rtt{2'000.0f + noise(t), 2'000.0f + noise(t + 3), 40'000.0f + noise(t)};
+      const std::vector<float> loss{0.0f, 0.0f, 0.001f};
+      bank.update(rtt, loss, ev);
+    }
+    EXPECT_TRUE(ev.empty()) << "false alarm, method " << static_cast<int>(method);
+
+    // Path 0: RTT 2 ms → 3 ms. Path 1: loss 0 → 2%. Path 2: unchanged.
+    int fired_at = -1;
+    for (; t < 100; ++t) {
+      const std::vector<float> rtt{3'000.0f + noise(t), 2'000.0f + noise(t + 3), 40'000.0f + noise(t)};
+      const std::vector<float> loss{0.0f, 0.02f, 0.001f};
+      if (bank.update(rtt, loss, ev) && fired_at < 0) fired_at = t;
+    }
+    ASSERT_EQ(ev.size(), 2u) << "method " << static_cast<int>(method);
+    EXPECT_LE(fired_at, 64);
+    for (const auto& e : ev) {
+      EXPECT_TRUE(e.increase);
+      if (e.path == 0) {
+        EXPECT_EQ(e.metric, PathMetric::Rtt);
+        EXPECT_NEAR(e.before, 2'000.0f, 100.0f);
+      } else {
+        EXPECT_EQ(e.path, 1u);
+        EXPECT_EQ(e.metric, PathMetric::Loss);
+      }
+    }
+    EXPECT_NEAR(bank.reference(0, PathMetric::Rtt), 3'000.0f, 100.0f);   // re-baselined
+
+    // Back to 2 ms: reported as a decrease.
+    ev.clear();
+    for (; t < 130; ++t) {
+      const std::vector<float> rtt{2'000.0f + noise(t), 2'000.0f + noise(t + 3), 40'000.0f + noise(t)};
+      const std::vector<float> loss{0.0f, 0.02f, 0.001f};
+      bank.update(rtt, loss, ev);
+    }
+    ASSERT_EQ(ev.size(), 1u);
+    EXPECT_EQ(ev[0].path, 0u);
+    EXPECT_FALSE(ev[0].increase);
+  }
+
+  // Fan-out: only services using the changed paths, each once.
+  alpha::routing::PathSubscribers subs(3);
+  subs.subscribe(0, 0);
+  subs.subscribe(1, 0);
+  subs.subscribe(1, 1);
+  subs.subscribe(2, 2);
+  const std::vector<ChangeEvent> ev{{.path = 0}, {.path = 1, .metric = PathMetric::Loss}};
+  std::vector<alpha::routing::ServiceHandle> hs;
+  EXPECT_EQ(subs.affected(ev, hs), 2u);
+  EXPECT_EQ(hs, (std::vector<alpha::routing::ServiceHandle>{0, 1}));
+  hs.clear();
+  EXPECT_EQ(subs.affected(ev, hs), 2u);   // fresh pass
+  subs.clear();
+  hs.clear();
+  EXPECT_EQ(subs.affected(ev, hs), 0u);
+}
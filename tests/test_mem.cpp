@@ -1,15 +1,24 @@
 /**
  * @file test_mem.cpp
- * @brief Tests for SpscQueue<T> (owning, RT) and PacketPool.
+ * @brief Tests for SpscQueue<T> / SpscQueue<T, N> (owning, RT, zero-copy API), PacketPool,
+ *        SpscByteRing, RingSet and StageRing.
  */
 #include <gtest/gtest.h>
 #include <atomic>
 #include <thread>
 #include <vector>
+#include <utility>
 #include <cstdint>
 #include <chrono>
+#include <cstring>
+#include <new>
+#include <span>
+#include <type_traits>
 
 #include "alpha/mem/packet_pool.hpp"
+#include "alpha/mem/byte_ring.hpp"
+#include "alpha/mem/ring_set.hpp"
+#include "alpha/mem/stage_ring.hpp"
 
 using alpha::mem::SpscQueue;
 using alpha::mem::PacketPool;
@@ -196,3 +205,339 @@ TEST(SpscQueue, MoveOnly_ProducerConsumer) {
   EXPECT_EQ(consumed.load(), N);
 }
 
+
+/**
+ * @test SpscQueue_ZeroCopy
+ * @brief try_reserve/commit, emplace, front/consume construct and read in place;
+ *        every constructed element is destroyed exactly once (incl. at teardown).
+ */
+namespace {
+struct Tracked {
+  static inline int live = 0;
+  std::uint64_t a;
+  std::uint32_t b;
+  Tracked(std::uint64_t x, std::uint32_t y) noexcept : a(x), b(y) { ++live; }
+  Tracked(const Tracked& o) noexcept : a(o.a), b(o.b) { ++live; }
+  Tracked(Tracked&& o) noexcept : a(o.a), b(o.b) { ++live; }
+  Tracked& operator=(const Tracked&) = default;
+  Tracked& operator=(Tracked&&) = default;
+  ~Tracked() { --live; }
+};
+} // namespace
+
+TEST(SpscQueue, ZeroCopy_Reserve_Emplace_Front_Consume) {
+  {
+    auto q = std::move(*SpscQueue<Tracked>::with_capacity(4));
+    Tracked* slot = q.try_reserve();
+    ASSERT_NE(slot, nullptr);
+    ::new (static_cast<void*>(slot)) Tracked(1, 10);
+    EXPECT_TRUE(q.empty()); // not visible before commit
+    q.commit();
+    EXPECT_TRUE(q.emplace(std::uint64_t{2}, std::uint32_t{20}));
+    EXPECT_TRUE(q.push(Tracked(3, 30)));
+    EXPECT_FALSE(q.emplace(std::uint64_t{4}, std::uint32_t{40})); // full (one slot open)
+    EXPECT_EQ(q.try_reserve(), nullptr);
+    EXPECT_EQ(Tracked::live, 3);
+
+    Tracked* f = q.front();
+    ASSERT_NE(f, nullptr);
+    EXPECT_EQ(f->a, 1u);
+    EXPECT_EQ(f->b, 10u);
+    q.consume();
+    EXPECT_EQ(Tracked::live, 2);
+
+    Tracked out(0, 0);
+    ASSERT_TRUE(q.pop(out));
+    EXPECT_EQ(out.a, 2u);
+    EXPECT_EQ(Tracked::live, 2); // one in ring + out
+  }
+  EXPECT_EQ(Tracked::live, 0); // queue destructor released the remaining element
+}
+
+/**
+ * @test SpscQueue_FixedCapacity
+ * @brief SpscQueue<T, N>: inline storage, usable from static memory, same FIFO/wrap
+ *        semantics as the heap-backed queue.
+ */
+TEST(SpscQueue, FixedCapacity_InlineStorage) {
+  using Q = SpscQueue<int, 8>;
+  static_assert(!std::is_move_constructible_v<Q>);
+  static_assert(alignof(Q) >= alpha::mem::kCacheLine);
+  static_assert(sizeof(Q) >= 8 * sizeof(int));
+
+  static Q q; // static storage, no setup
+  EXPECT_EQ(q.capacity(), 8u);
+  EXPECT_TRUE(q.empty());
+  for (int i = 0; i < 7; ++i) EXPECT_TRUE(q.push(i));
+  EXPECT_TRUE(q.full());
+  EXPECT_FALSE(q.emplace(99));
+  int v{};
+  for (int i = 0; i < 5; ++i) { ASSERT_TRUE(q.pop(v)); EXPECT_EQ(v, i); }
+  for (int i = 100; i < 105; ++i) EXPECT_TRUE(q.emplace(i)); // wrap
+  EXPECT_EQ(q.approx_size(), 7u);
+  std::vector<int> out;
+  while (int* f = q.front()) { out.push_back(*f); q.consume(); }
+  EXPECT_EQ(out, (std::vector<int>{5, 6, 100, 101, 102, 103, 104}));
+}
+
+TEST(SpscQueue, FixedCapacity_ProducerConsumer) {
+  auto q = std::make_unique<SpscQueue<std::uint64_t, 64>>();
+  constexpr std::uint64_t N = 200000;
+  std::thread prod([&]{
+    for (std::uint64_t i = 0; i < N; ) { if (q->push(i)) ++i; else std::this_thread::yield(); }
+  });
+  std::uint64_t expect = 0, v = 0;
+  bool ok = true;
+  while (expect < N) {
+    if (q->pop(v)) { ok = ok && v == expect; ++expect; } else std::this_thread::yield();
+  }
+  prod.join();
+  EXPECT_TRUE(ok);
+  EXPECT_TRUE(q->empty());
+}
+
+// ---------- SpscByteRing ----------
+
+using alpha::mem::SpscByteRing;
+
+TEST(SpscByteRing, WithCapacity_Validation) {
+  EXPECT_FALSE(SpscByteRing::with_capacity(0).has_value());
+  EXPECT_FALSE(SpscByteRing::with_capacity(8).has_value());
+  EXPECT_FALSE(SpscByteRing::with_capacity(100).has_value());
+  auto ok = SpscByteRing::with_capacity(256);
+  ASSERT_TRUE(ok);
+  EXPECT_EQ(ok->capacity(), 256u);
+  EXPECT_EQ(ok->max_record(), 120u);
+}
+
+/**
+ * @test SpscByteRing_Wrap_Padding
+ * @brief Records that would straddle the end are written at offset 0 behind padding;
+ *        partial commit shrinks the record; a full ring rejects reserve().
+ */
+TEST(SpscByteRing, ReserveCommitPeekRelease_Wrap) {
+  auto r = std::move(*SpscByteRing::with_capacity(64));
+  EXPECT_EQ(r.peek().data(), nullptr);
+
+  // 48 bytes used (32 + 16), then free the first record: tail at 48, head at 32.
+  auto a = r.reserve(24);
+  ASSERT_EQ(a.size(), 24u);
+  std::memset(a.data(), 0xAA, a.size());
+  r.commit(24);
+  ASSERT_TRUE(r.write(std::as_bytes(std::span<const char>("xyz", 3))));
+  auto p = r.peek();
+  ASSERT_EQ(p.size(), 24u);
+  EXPECT_EQ(p[0], std::byte{0xAA});
+  r.release();
+
+  // 20-byte record needs 32 bytes; only 16 remain before the end → pad + wrap to 0.
+  auto b = r.reserve(20);
+  ASSERT_EQ(b.size(), 20u);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b.data()) % SpscByteRing::kRecordAlign, 0u);
+  std::memset(b.data(), 0x5B, b.size());
+  r.commit(4); // shrink: only 4 bytes used
+
+  p = r.peek();
+  ASSERT_EQ(p.size(), 3u);
+  EXPECT_EQ(std::memcmp(p.data(), "xyz", 3), 0);
+  r.release();
+  p = r.peek(); // padding skipped
+  ASSERT_EQ(p.size(), 4u);
+  EXPECT_EQ(p[3], std::byte{0x5B});
+  r.release();
+  EXPECT_TRUE(r.empty());
+
+  EXPECT_EQ(r.reserve(r.max_record() + 1).data(), nullptr);
+}
+
+TEST(SpscByteRing, ProducerConsumer_VariableLength) {
+  auto r = std::move(*SpscByteRing::with_capacity(1024));
+  constexpr std::uint32_t N = 50000;
+
+  std::thread prod([&]{
+    for (std::uint32_t i = 0; i < N; ) {
+      const std::size_t len = sizeof(std::uint32_t) + (i % 61);
+      auto dst = r.reserve(len);
+      if (dst.data() == nullptr) { std::this_thread::yield(); continue; }
+      std::memcpy(dst.data(), &i, sizeof i);
+      std::memset(dst.data() + sizeof i, static_cast<int>(i & 0xFF), len - sizeof i);
+      r.commit(len);
+      ++i;
+    }
+  });
+
+  std::uint32_t expect = 0;
+  bool ok = true;
+  while (expect < N) {
+    auto rec = r.peek();
+    if (rec.data() == nullptr) { std::this_thread::yield(); continue; }
+    std::uint32_t v{};
+    std::memcpy(&v, rec.data(), sizeof v);
+    ok = ok && v == expect && rec.size() == sizeof v + (expect % 61);
+    for (std::size_t k = sizeof v; ok && k < rec.size(); ++k) ok = rec[k] == std::byte(expect & 0xFF);
+    r.release();
+    ++expect;
+  }
+  prod.join();
+  EXPECT_TRUE(ok);
+  EXPECT_TRUE(r.empty());
+}
+
+// ---------- RingSet ----------
+
+using alpha::mem::RingSet;
+
+/**
+ * @test RingSet_Fairness
+ * @brief Only notified rings are visited; bursts rotate across rings; a ring that the
+ *        budget cannot reach is counted as skipped and served first next round.
+ */
+TEST(RingSet, BurstFair_SkipsIdle_TracksStarvation) {
+  using Ring = SpscQueue<int, 64>;
+  Ring r0, r1, r2;
+  RingSet<Ring> set({.burst = 4, .budget = 6, .spin_polls = 0, .yield_polls = 0});
+  ASSERT_EQ(set.add(r0), 0);
+  ASSERT_EQ(set.add(r1), 1);
+  ASSERT_EQ(set.add(r2), 2);
+
+  for (int i = 0; i < 10; ++i) ASSERT_TRUE(r0.push(i));
+  for (int i = 0; i < 10; ++i) ASSERT_TRUE(r2.push(100 + i));
+  set.notify(0);
+  set.notify(2);
+  EXPECT_EQ(set.pending(), 0b101u);
+
+  std::vector<std::pair<std::size_t, int>> got;
+  auto sink = [&](std::size_t ring, int& v) { got.emplace_back(ring, v); };
+
+  EXPECT_EQ(set.poll(sink), 6u); // r0: 4 (burst), r2: 2 (budget)
+  EXPECT_EQ(got.front(), (std::pair<std::size_t, int>{0, 0}));
+  EXPECT_EQ(got.back(), (std::pair<std::size_t, int>{2, 101}));
+  EXPECT_EQ(set.starvation(1).served, 0u); // idle ring never touched
+
+  got.clear();
+  EXPECT_EQ(set.poll(sink), 6u); // cursor after r2 → r0 first again
+  EXPECT_EQ(got.front().first, 0u);
+
+  // Drain everything; bits clear once rings are observed empty.
+  while (set.poll(sink) != 0) {}
+  EXPECT_EQ(set.pending(), 0u);
+  EXPECT_EQ(set.starvation(0).served, 10u);
+  EXPECT_EQ(set.starvation(2).served, 10u);
+
+  // Budget 6 with burst 4 across three busy rings: one ring is skipped per round.
+  for (auto* r : {&r0, &r1, &r2}) for (int i = 0; i < 20; ++i) ASSERT_TRUE(r->push(i));
+  for (std::size_t i = 0; i < 3; ++i) set.notify(i);
+  for (int round = 0; round < 6; ++round) set.poll(sink);
+  for (std::size_t i = 0; i < 3; ++i) {
+    EXPECT_GE(set.starvation(i).max_skipped, 1u);
+    EXPECT_LE(set.starvation(i).max_skipped, 1u); // rotating start bounds the wait
+  }
+}
+
+/**
+ * @test RingSet_Park_Wake
+ * @brief An idle worker sleeps on the combined signal; a notify() from any producer
+ *        or wake() brings it back.
+ */
+TEST(RingSet, ParkedWorker_WakesOnNotify) {
+  using Ring = SpscQueue<int, 16>;
+  Ring r0, r1;
+  RingSet<Ring> set({.burst = 8, .budget = 16, .spin_polls = 1, .yield_polls = 1});
+  set.add(r0);
+  set.add(r1);
+
+  std::atomic<bool> stop{false};
+  std::atomic<int>  sum{0};
+  std::thread worker([&]{
+    while (!stop.load(std::memory_order_acquire)) {
+      if (set.poll([&](std::size_t, int& v) { sum.fetch_add(v); }) == 0) set.idle();
+    }
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20)); // let it park
+  ASSERT_TRUE(r1.push(5));
+  set.notify(1);
+  for (int i = 0; i < 200 && sum.load() != 5; ++i) std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  EXPECT_EQ(sum.load(), 5);
+
+  stop.store(true, std::memory_order_release);
+  set.wake();
+  worker.join();
+}
+
+// ---------- StageRing ----------
+
+using alpha::mem::StageRing;
+
+/**
+ * @test StageRing_Barriers
+ * @brief A stage sees only what the previous stage released; the producer only
+ *        reuses slots the last stage released.
+ */
+TEST(StageRing, SequenceBarriers_SingleThread) {
+  auto ring = std::make_unique<StageRing<int, 8, 2>>();
+
+  auto c = ring->try_claim(16);
+  EXPECT_EQ(c.first, 0u);
+  EXPECT_EQ(c.count, 8u); // capped by capacity
+  for (std::size_t i = 0; i < c.count; ++i) (*ring)[c.first + i] = static_cast<int>(i);
+  EXPECT_EQ(ring->available(0, 8).count, 0u); // not published yet
+  ring->publish(c);
+
+  EXPECT_EQ(ring->available(1, 8).count, 0u); // stage 0 has released nothing
+  auto b0 = ring->available(0, 3);
+  ASSERT_EQ(b0.count, 3u);
+  for (std::size_t i = 0; i < b0.count; ++i) (*ring)[b0.first + i] *= 10;
+  ring->release(0, b0);
+
+  auto b1 = ring->available(1, 8);
+  ASSERT_EQ(b1.count, 3u);
+  EXPECT_EQ((*ring)[b1.first + 2], 20);
+  EXPECT_EQ(ring->try_claim(4).count, 0u); // ring full until the last stage releases
+  ring->release(1, b1);
+  EXPECT_EQ(ring->in_flight(), 5u);
+
+  auto c2 = ring->try_claim(4);
+  EXPECT_EQ(c2.first, 8u);
+  EXPECT_EQ(c2.count, 3u);
+}
+
+/**
+ * @test StageRing_Pipeline
+ * @brief Producer + 3 stages on separate threads; every slot passes every stage in order.
+ */
+TEST(StageRing, Pipeline_ThreeStages_Concurrent) {
+  struct Pkt { std::uint64_t id; std::uint32_t marks; };
+  constexpr std::size_t kStages = 3;
+  constexpr std::uint64_t N = 100000;
+  auto ring = std::make_unique<StageRing<Pkt, 256, kStages>>();
+
+  std::atomic<bool> ok{true};
+  auto stage = [&](std::size_t k) {
+    std::uint64_t expect = 0;
+    while (expect < N) {
+      auto b = ring->available(k, 32);
+      if (b.count == 0) { std::this_thread::yield(); continue; }
+      for (std::size_t i = 0; i < b.count; ++i) {
+        Pkt& p = (*ring)[b.first + i];
+        // Each stage must see the previous stages' marks and the right packet.
+        if (p.id != expect || p.marks != (1u << k) - 1u) ok.store(false);
+        p.marks |= 1u << k;
+        ++expect;
+      }
+      ring->release(k, b);
+    }
+  };
+  std::thread s0(stage, 0), s1(stage, 1), s2(stage, 2);
+
+  for (std::uint64_t id = 0; id < N; ) {
+    auto c = ring->try_claim(16);
+    if (c.count == 0) { std::this_thread::yield(); continue; }
+    for (std::size_t i = 0; i < c.count; ++i) (*ring)[c.first + i] = Pkt{id++, 0};
+    ring->publish(c);
+  }
+  s0.join(); s1.join(); s2.join();
+  EXPECT_TRUE(ok.load());
+  EXPECT_EQ(ring->stage_seq(kStages - 1), N);
+  EXPECT_EQ(ring->in_flight(), 0u);
+}
@@ -0,0 +1,186 @@
+/**
+ * @file test_os.cpp
+ * @brief Tests for OS-layer helpers (hitless-restart handoff).
+ *
+ * Validates:
+ *  - memfd region sections survive a remap through a received descriptor
+ *  - SCM_RIGHTS offer carries the region plus tagged I/O descriptors
+ *  - FlowTable adopts pins in place from a handoff section (and refuses a full one)
+ *  - TSC clock tracks steady_clock after calibration; BurstClock holds one sample per burst
+ */
+#include <gtest/gtest.h>
+#include <array>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include "alpha/os/clock.hpp"
+#include "alpha/os/handoff.hpp"
+#include "alpha/routing/flow_table.hpp"
+#include "alpha/routing/service_registry.hpp"
+
+using alpha::os::HandoffChannel;
+using alpha::os::HandoffFd;
+using alpha::os::HandoffRegion;
+namespace handoff_kind = alpha::os::handoff_kind;
+
+// --------------------------- HandoffRegion ----------------------------------
+
+TEST(Handoff, Region_Allocate_Find) {
+  auto r = HandoffRegion::create(1 << 16);
+  ASSERT_TRUE(r);
+  auto a = r->allocate(handoff_kind::FlowTable, 0, 1000);
+  ASSERT_TRUE(a);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(a->data()) % 64, 0u);
+  EXPECT_FALSE(r->allocate(handoff_kind::FlowTable, 0, 8)); // duplicate
+  EXPECT_FALSE(r->allocate(handoff_kind::App, 0, std::size_t{1} << 30)); // too large
+
+  auto f = r->find(handoff_kind::FlowTable, 0);
+  ASSERT_TRUE(f);
+  EXPECT_EQ(f->data(), a->data());
+  EXPECT_FALSE(r->find(handoff_kind::RegistrySnapshot, 0));
+}
+
+/**
+ * @test Handoff_EndToEnd
+ * @brief Old side builds state in a region and offers it with an I/O fd; new side
+ *        maps it, adopts the flow table and the registry, and uses the passed fd.
+ */
+TEST(Handoff, EndToEnd_OfferReadyCommit) {
+  int sv[2];
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv), 0);
+  HandoffChannel old_side(sv[0]), new_side(sv[1]);
+
+  int io[2];
+  ASSERT_EQ(::pipe(io), 0);
+
+  // ---- old process: state lives in the region from startup ----
+  constexpr std::size_t kSlots = 256;
+  auto region = HandoffRegion::create(kSlots * sizeof(alpha::routing::FlowEntry) + 4096);
+  ASSERT_TRUE(region);
+  auto flow_bytes = region->allocate(handoff_kind::FlowTable, 0, kSlots * sizeof(alpha::routing::FlowEntry));
+  ASSERT_TRUE(flow_bytes);
+  alpha::routing::FlowTable old_flows(HandoffRegion::as<alpha::routing::FlowEntry>(*flow_bytes), /*adopt=*/false);
+  ASSERT_TRUE(old_flows.insert(11, 1, 4));
+  ASSERT_TRUE(old_flows.insert(22, 2, 5));
+
+  alpha::routing::ServiceRegistry old_reg;
+  alpha::routing::PopList pops{alpha::routing::Pop{.id="nyc", .region="us-east", .ip="192.0.2.1"}};
+  ASSERT_EQ(old_reg.addService("web", std::span<const alpha::routing::Pop>(pops)), alpha::routing::RegistryErr::Ok);
+
+  std::thread old_proc([&] {
+    const std::array<HandoffFd, 1> fds{HandoffFd{.role = 7, .fd = io[1]}};
+    ASSERT_TRUE(old_side.send_offer(*region, fds));
+    ASSERT_TRUE(old_side.expect(HandoffChannel::Op::Ready));
+    // Quiesce: final registry snapshot, then commit.
+    auto reg_bytes = region->allocate(handoff_kind::RegistrySnapshot, 0, 1024);
+    ASSERT_TRUE(reg_bytes);
+    ASSERT_GT(old_reg.serializeSnapshot(*reg_bytes), 0u);
+    ASSERT_TRUE(old_side.send(HandoffChannel::Op::Commit));
+  });
+
+  // ---- new process ----
+  auto offer = new_side.recv_offer();
+  ASSERT_TRUE(offer);
+  ASSERT_EQ(offer->fds.size(), 1u);
+  EXPECT_EQ(offer->fds[0].role, 7u);
+  auto mapped = HandoffRegion::attach(offer->region_fd);
+  ASSERT_TRUE(mapped);
+  ASSERT_TRUE(new_side.send(HandoffChannel::Op::Ready));
+  ASSERT_TRUE(new_side.expect(HandoffChannel::Op::Commit));
+  old_proc.join();
+
+  auto adopted_bytes = mapped->find(handoff_kind::FlowTable, 0);
+  ASSERT_TRUE(adopted_bytes);
+  ASSERT_TRUE(alpha::routing::FlowTable::can_adopt(HandoffRegion::as<alpha::routing::FlowEntry>(*adopted_bytes)));
+  alpha::routing::FlowTable flows(HandoffRegion::as<alpha::routing::FlowEntry>(*adopted_bytes), /*adopt=*/true);
+  EXPECT_EQ(flows.size(), 2u);
+  ASSERT_NE(flows.find(22), nullptr);
+  EXPECT_EQ(flows.find(22)->path, 5u);
+
+  auto reg_bytes = mapped->find(handoff_kind::RegistrySnapshot, 0);
+  ASSERT_TRUE(reg_bytes);
+  alpha::routing::ServiceRegistry new_reg;
+  ASSERT_EQ(new_reg.restoreSnapshot(*reg_bytes), alpha::routing::RegistryErr::Ok);
+  EXPECT_EQ(new_reg.getPopsCopy("web"), pops);
+
+  // The passed descriptor is a live duplicate of the old write end.
+  const char msg[] = "hi";
+  ASSERT_EQ(::write(offer->fds[0].fd, msg, sizeof(msg)), static_cast<ssize_t>(sizeof(msg)));
+  char buf[sizeof(msg)]{};
+  ASSERT_EQ(::read(io[0], buf, sizeof(buf)), static_cast<ssize_t>(sizeof(msg)));
+  EXPECT_STREQ(buf, msg);
+
+  ::close(offer->fds[0].fd);
+  ::close(io[0]);
+  ::close(io[1]);
+}
+
+/**
+ * @test FlowTable_AdoptRejectsFullRegion
+ * @brief A region past the 3/4 load cap (corrupt or foreign) is not adoptable: can_adopt()
+ *        says so up front and the adopting constructor aborts instead of probing forever.
+ */
+TEST(Handoff, FlowTable_AdoptRejectsFullRegion) {
+  using alpha::routing::FlowEntry;
+  using alpha::routing::FlowTable;
+  std::vector<FlowEntry> region(16);
+  for (std::size_t i = 0; i < region.size(); ++i) region[i].key = i + 1;   // no empty slot
+  EXPECT_FALSE(FlowTable::can_adopt(region));
+  EXPECT_DEATH({ FlowTable t(region, /*adopt=*/true); }, "");
+
+  for (std::size_t i = 12; i < region.size(); ++i) region[i] = FlowEntry{};   // exactly at the cap
+  EXPECT_TRUE(FlowTable::can_adopt(region));
+  FlowTable ok(region, /*adopt=*/true);
+  EXPECT_EQ(ok.size(), 12u);
+  EXPECT_EQ(ok.find(99), nullptr);
+  EXPECT_FALSE(FlowTable::can_adopt(std::span<const FlowEntry>(region.data(), 12)));  // not a power of two
+}
+
+// --------------------------- TscClock -----------------------------------------
+
+TEST(Clock, Tsc_TracksSteadyClock_And_BurstClock) {
+  using namespace std::chrono;
+  using alpha::os::TscClock;
+  const auto cal = TscClock::calibrate(milliseconds{10});
+  EXPECT_EQ(cal.enabled, cal.invariant);
+  EXPECT_TRUE(!cal.enabled || cal.hz > 1'000'000u) << cal.hz;
+
+  auto prev = TscClock::now();
+  for (int i = 0; i < 1000; ++i) {
+    const auto t = TscClock::now();
+    ASSERT_GE(t, prev);
+    prev = t;
+  }
+  // Same time base as steady_clock (mixable with vDSO timestamps).
+  const auto drift = duration_cast<microseconds>(TscClock::now() - steady_clock::now()).count();
+  EXPECT_LT(drift < 0 ? -drift : drift, 5000);
+
+  alpha::os::BurstClock clk;
+  const auto b0 = clk.refresh();
+  std::this_thread::sleep_for(milliseconds{2});
+  EXPECT_EQ(clk.now(), b0);                       // coarse: unchanged within a burst
+  EXPECT_GE(clk.refresh() - b0, milliseconds{2});
+}
+
+/**
+ * @test Tsc_ToNs_SlowCounter
+ * @brief Tick conversion stays exact for a 25 MHz counter (AArch64 generic timer) and a 3 GHz TSC,
+ *        including deltas with all low 32 bits set and uptimes of a year.
+ */
+TEST(Clock, Tsc_ToNs_SlowCounter) {
+  using alpha::os::TscClock;
+  constexpr std::uint64_t m25 = TscClock::mult_for(40.0);   // 25 MHz: 40 ns per tick
+  EXPECT_EQ(TscClock::ticks_to_ns(25'000'000u, m25), 1'000'000'000);
+  EXPECT_EQ(TscClock::ticks_to_ns(0xFFFF'FFFFu, m25), std::int64_t{40} * 0xFFFF'FFFF);
+  constexpr std::uint64_t year = 25'000'000ull * 86'400 * 365;
+  EXPECT_EQ(TscClock::ticks_to_ns(year, m25), static_cast<std::int64_t>(year * 40));
+
+  constexpr std::uint64_t m3g = TscClock::mult_for(1.0 / 3.0);   // 3 GHz
+  const std::int64_t s = TscClock::ticks_to_ns(3'000'000'000u, m3g);
+  EXPECT_LE(1'000'000'000 - s, 1);
+  EXPECT_GE(1'000'000'000 - s, 0);
+}
@@ -1,3 +1,80 @@
-//
-// Created by Azadeh Aftahi on 10/1/25.
-//
\ No newline at end of file
+/**
+ * @file test_qos.cpp
+ * @brief Tests for QoSPolicy scoring tables.
+ *
+ * Validates:
+ *  - constexpr default tables equal the runtime-compiled ones
+ *  - Fixed-point normalization and DSCP <-> class lookups
+ *  - Runtime override via update_config()
+ *  - Partial DSCP maps leave DSCP 0 to BestEffort
+ */
+
+#include <gtest/gtest.h>
+#include <cstddef>
+
+#include "alpha/config/config_loader.hpp"
+#include "alpha/config/policy_tables.hpp"
+#include "alpha/routing/qos_policy.hpp"
+
+using alpha::routing::QoSClass;
+using alpha::routing::QoSPolicy;
+
+/**
+ * @test QoSTables_Constexpr_MatchesRuntime
+ * @brief constexpr default tables equal the ones compiled from the loader's map config;
+ *        runtime override rebuilds them.
+ */
+TEST(QoSPolicy, ConstexprTables_MatchRuntime_And_Override) {
+  constexpr auto& tab = alpha::config::kDefaultQoSTables;
+  static_assert(tab.dscp_by_class[static_cast<std::size_t>(QoSClass::Interactive)] == alpha::config::constants::DSCP_AF31);
+
+  const QoSPolicy from_cfg{alpha::config::Loader::load_from_file("").qos};
+  const QoSPolicy from_tab{alpha::config::kDefaultQoSProfile, tab};
+  for (std::size_t c = 0; c < alpha::routing::kQoSClassCount; ++c) {
+    EXPECT_EQ(from_cfg.tables().inv_latency_q32[c], tab.inv_latency_q32[c]);
+    EXPECT_EQ(from_cfg.tables().dscp_by_class[c], tab.dscp_by_class[c]);
+    EXPECT_EQ(from_cfg.tables().class_by_dscp, tab.class_by_dscp);
+  }
+  EXPECT_EQ(from_tab.class_of(alpha::config::constants::DSCP_EF), QoSClass::Realtime);
+  EXPECT_EQ(from_tab.class_of(0x3F), QoSClass::BestEffort); // unmapped
+
+  // Within target → 1.0; latency at 2x target halves its component.
+  const alpha::routing::PathMetrics ok{.path_id = "a", .latency_us = 1000, .jitter_us = 100, .loss = 0.0};
+  const alpha::routing::PathMetrics slow{.path_id = "b", .latency_us = 2 * alpha::config::constants::QOS_RT_MAX_LAT_US,
+                                         .jitter_us = 100, .loss = 0.0};
+  EXPECT_DOUBLE_EQ(from_tab.score_path(ok, QoSClass::Realtime).score, 1.0);
+  const auto s = from_cfg.score_path(slow, QoSClass::Realtime);
+  EXPECT_FALSE(s.within_thresholds);
+  EXPECT_NEAR(s.score, 1.0 - 0.5 * alpha::config::constants::QOS_WEIGHT_LATENCY, 1e-6);
+
+  // Runtime override: remap Realtime to CS6's codepoint.
+  QoSPolicy over{alpha::config::kDefaultQoSProfile, tab};
+  auto cfg = over.config();
+  cfg.dscp_by_class[QoSClass::Realtime] = 0x30;
+  over.update_config(cfg);
+  EXPECT_EQ(over.dscp(QoSClass::Realtime), 0x30);
+  EXPECT_EQ(over.class_of(0x30), QoSClass::Realtime);
+  EXPECT_EQ(over.class_of(alpha::config::constants::DSCP_EF), QoSClass::BestEffort);
+}
+
+/**
+ * @test QoSTables_PartialDscpMap
+ * @brief Classes missing from a runtime DSCP map do not claim DSCP 0: it stays BestEffort,
+ *        and the partial map survives a profile round trip.
+ */
+TEST(QoSPolicy, PartialDscpMap_KeepsDscp0_BestEffort) {
+  alpha::routing::QoSConfig cfg = alpha::config::Loader::load_from_file("").qos;
+  cfg.dscp_by_class.clear();
+  cfg.dscp_by_class[QoSClass::Bulk] = alpha::config::constants::DSCP_CS1;
+  cfg.dscp_by_class[QoSClass::Realtime] = alpha::config::constants::DSCP_EF;
+  const QoSPolicy p{cfg};
+
+  EXPECT_EQ(p.class_of(0), QoSClass::BestEffort);   // not Interactive (the highest unmapped class)
+  EXPECT_EQ(p.class_of(alpha::config::constants::DSCP_EF), QoSClass::Realtime);
+  EXPECT_EQ(p.class_of(alpha::config::constants::DSCP_CS1), QoSClass::Bulk);
+  EXPECT_EQ(p.dscp(QoSClass::Interactive), 0u);     // unmapped classes still mark Best Effort
+
+  const auto back = alpha::routing::to_config(alpha::routing::to_profile(cfg));
+  EXPECT_EQ(back.dscp_by_class.size(), 2u);
+  EXPECT_EQ(back.dscp_by_class.count(QoSClass::Interactive), 0u);
+}
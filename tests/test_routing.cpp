@@ -7,17 +7,42 @@
  *  - addService / upsertService / replaceService / removeService behavior
  *  - Heterogeneous lookup with std::string_view keys
  *  - No torn reads under 1 writer / many readers
+ *  - FlowTable pinning and RSS bucket rebalancing/migration
+ *  - Per-path flow counters and bounded-load placement
+ *  - Overlay relay routes vs brute force; incremental shortest paths vs Floyd–Warshall
+ *  - Gated traffic-shift ramps and flow-hash split stability
+ *  - Burst (group-prefetch) lookups in FlowTable and ServiceIndex
+ *  - Fixed-count (N = 2..4) policy choosers vs the generic loops
  */
 
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <thread>
 #include <vector>
 #include <string_view>
 #include <chrono>
+#include <cmath>
+#include <random>
+#include <unordered_map>
 
 #include "alpha/routing/pop.hpp"
 #include "alpha/routing/service_registry.hpp"
+#include "alpha/routing/flow_table.hpp"
+#include "alpha/routing/bounded_load.hpp"
+#include "alpha/routing/rss_table.hpp"
+#include "alpha/routing/service_index.hpp"
+#include "alpha/routing/path_selection.hpp"
+#include "alpha/routing/metrics_table.hpp"
+#include "alpha/routing/candidate_set.hpp"
+#include "alpha/routing/decision_table.hpp"
+#include "alpha/routing/classifier.hpp"
+#include "alpha/routing/vip_table.hpp"
+#include "alpha/routing/overlay.hpp"
+#include "alpha/routing/shortest_path.hpp"
+#include "alpha/routing/traffic_shift.hpp"
+#include "alpha/routing/policy_binding.hpp"
 
 using namespace std::chrono_literals;
 using alpha::routing::Pop;
@@ -292,3 +317,1206 @@ TEST(ServiceRegistry, Registry_Validation_Rejections_DoNotPublish) {
   }
 }
 
+// --------------------------- Snapshot transfer ------------------------------
+
+/**
+ * @test Registry_Snapshot_RoundTrip
+ * @brief serializeSnapshot/restoreSnapshot reproduce the map; corrupt input publishes nothing.
+ */
+TEST(ServiceRegistry, Registry_Snapshot_RoundTrip) {
+  ServiceRegistry src;
+  PopList a{ Pop{.id="nyc", .region="us-east", .ip="192.0.2.10", .weight=7, .health=alpha::routing::Health::Degraded,
+                 .srlg=0x8000'0000'0000'0005ull} };
+  PopList b{ Pop{.id="sfo", .region="us-west", .ip="2001:db8::1"} };
+  ASSERT_EQ(src.addService("web", as_span(a)), alpha::routing::RegistryErr::Ok);
+  ASSERT_EQ(src.addService("api", as_span(b)), alpha::routing::RegistryErr::Ok);
+
+  std::array<std::byte, 512> buf{};
+  const auto n = src.serializeSnapshot(buf);
+  ASSERT_GT(n, 0u);
+  EXPECT_EQ(src.serializeSnapshot(std::span<std::byte>(buf.data(), 8)), 0u); // too small
+
+  ServiceRegistry dst;
+  ASSERT_EQ(dst.restoreSnapshot(std::span<const std::byte>(buf.data(), n)), alpha::routing::RegistryErr::Ok);
+  EXPECT_EQ(*dst.snapshot(), *src.snapshot());
+
+  ServiceRegistry bad;
+  EXPECT_EQ(bad.restoreSnapshot(std::span<const std::byte>(buf.data(), n - 3)), alpha::routing::RegistryErr::Invalid);
+  EXPECT_TRUE(bad.snapshot()->empty());
+}
+
+// --------------------------- FlowTable --------------------------------------
+
+using alpha::routing::FlowEntry;
+using alpha::routing::FlowTable;
+
+/**
+ * @test FlowTable_Insert_Find_Erase
+ * @brief Randomized insert/erase against std::unordered_map (checks backward-shift delete).
+ */
+TEST(FlowTable, Insert_Find_Erase_MatchesReference) {
+  FlowTable ft(1024);
+  std::unordered_map<std::uint64_t, std::uint32_t> ref;
+  std::mt19937_64 rng{42};
+
+  for (int i = 0; i < 20000; ++i) {
+    const std::uint64_t key = (rng() % 900) + 1;
+    if (rng() & 1) {
+      const auto path = static_cast<std::uint32_t>(rng() % 7);
+      if (ft.insert(key, static_cast<std::uint32_t>(key), path)) ref[key] = path;
+    } else {
+      EXPECT_EQ(ft.erase(key), ref.erase(key) == 1);
+    }
+  }
+  ASSERT_EQ(ft.size(), ref.size());
+  for (const auto& [k, p] : ref) {
+    const FlowEntry* e = ft.find(k);
+    ASSERT_NE(e, nullptr);
+    EXPECT_EQ(e->path, p);
+  }
+  EXPECT_EQ(ft.find(0), nullptr);
+  EXPECT_FALSE(ft.insert(0, 0, 1)); // key 0 reserved
+}
+
+TEST(FlowTable, LoadCap_And_EraseIf) {
+  FlowTable ft(64);
+  std::size_t inserted = 0;
+  for (std::uint64_t k = 1; k <= 64; ++k) inserted += ft.insert(k, static_cast<std::uint32_t>(k), 0) ? 1u : 0u;
+  EXPECT_EQ(inserted, ft.max_size());
+
+  const auto erased = ft.erase_if([](const FlowEntry& e) { return (e.hash & 1u) == 0; });
+  EXPECT_EQ(ft.size(), inserted - erased);
+  ft.for_each([](const FlowEntry& e) { EXPECT_EQ(e.hash & 1u, 1u); });
+  for (std::uint64_t k = 1; k <= inserted; k += 2) EXPECT_NE(ft.find(k), nullptr);
+}
+
+/**
+ * @test FlowTable_FindBurst
+ * @brief find_burst() agrees with find() for hits and misses, including a ragged tail.
+ */
+TEST(FlowTable, FindBurst_MatchesScalar) {
+  FlowTable ft(4096);
+  std::mt19937_64 rng{7};
+  std::vector<std::uint64_t> keys;
+  for (int i = 0; i < 2000; ++i) {
+    const std::uint64_t k = rng() | 1u;
+    if (ft.insert(k, static_cast<std::uint32_t>(k), static_cast<std::uint32_t>(i % 5))) keys.push_back(k);
+  }
+  std::vector<std::uint64_t> probe;
+  for (int i = 0; i < 37; ++i) probe.push_back((i % 3 == 0) ? (rng() | 1u) : keys[rng() % keys.size()]);
+
+  std::vector<const FlowEntry*> out(probe.size());
+  ft.find_burst(probe, out);
+  for (std::size_t i = 0; i < probe.size(); ++i) EXPECT_EQ(out[i], ft.find(probe[i])) << i;
+}
+
+/**
+ * @test BoundedLoad_Counters_And_Cap
+ * @brief Counters stay exact through re-pins/erase_if; skewed hashes never push a path past the cap,
+ *        placements are sticky while loads are unchanged and unhealthy paths are skipped.
+ */
+TEST(FlowTable, BoundedLoad_Counters_And_Cap) {
+  using alpha::routing::BoundedLoadPolicy;
+  using alpha::routing::CandidateRef;
+  using alpha::routing::PacketContext;
+  using alpha::routing::PathMetrics;
+
+  FlowTable ft(8192);
+  ASSERT_TRUE(ft.insert(1, 1, 2));
+  ft.track_paths(4);                                   // counts pins already present
+  EXPECT_EQ(ft.active_flows(2), 1u);
+  ASSERT_TRUE(ft.insert(1, 1, 3));                     // re-pin moves the count
+  EXPECT_EQ(ft.active_flows(2), 0u);
+  EXPECT_EQ(ft.active_flows(3), 1u);
+  EXPECT_TRUE(ft.erase(1));
+  EXPECT_EQ(ft.active_flows(3), 0u);
+  EXPECT_EQ(ft.active_flows(99), 0u);                  // untracked
+
+  std::array<alpha::routing::MetricsSlot, 4> slots{};
+  std::array<CandidateRef, 4> cands{};
+  for (std::size_t i = 0; i < slots.size(); ++i) {
+    alpha::routing::cp::update_metrics(slots[i], PathMetrics{.rtt_us = 100, .healthy = true});
+    cands[i] = {static_cast<alpha::routing::PathId>(i), &slots[i]};
+  }
+  BoundedLoadPolicy pol(ft, {.epsilon_ppm = 100'000, .skip_unhealthy = true});
+  const PacketContext probe{.flow_hash = 0xDEADBEEFu, .dscp = 0};
+  EXPECT_EQ(pol.choose(cands, probe), pol.choose(cands, probe));
+
+  // Skewed arrivals: every flow hash falls in a narrow band (one ring owner).
+  std::mt19937_64 rng{11};
+  for (std::uint64_t k = 1; k <= 4000; ++k) {
+    const PacketContext pkt{.flow_hash = 0x40000000u + static_cast<std::uint32_t>(rng() % 4096), .dscp = 0};
+    ASSERT_TRUE(ft.insert(k, pkt.flow_hash, pol.choose(cands, pkt)));
+    std::uint32_t worst = 0;
+    for (const auto c : ft.path_flows()) worst = std::max(worst, c);
+    ASSERT_LE(worst, pol.cap(ft.size() - 1, 4)) << k;
+  }
+  EXPECT_GT(pol.spilled(), 0u);
+
+  // Counters agree with a scan after a bulk erase.
+  ft.erase_if([](const FlowEntry& e) { return (e.key % 3) == 0; });
+  std::array<std::uint32_t, 4> scan{};
+  ft.for_each([&](const FlowEntry& e) { ++scan[e.path]; });
+  for (std::size_t p = 0; p < scan.size(); ++p) EXPECT_EQ(ft.active_flows(static_cast<alpha::routing::PathId>(p)), scan[p]);
+
+  // An unhealthy path takes no new flows.
+  alpha::routing::cp::update_metrics(slots[1], PathMetrics{.rtt_us = 100, .healthy = false});
+  for (std::uint32_t h = 0; h < 500; ++h)
+    EXPECT_NE(pol.choose(cands, {.flow_hash = h * 0x9E3779B9u, .dscp = 0}), 1u);
+}
+
+// --------------------------- ServiceIndex -----------------------------------
+
+using alpha::routing::ServiceIndex;
+
+/**
+ * @test ServiceIndex_Compile_Lookup
+ * @brief Handles follow id order; scalar and burst lookups agree; unknown ids miss.
+ */
+TEST(ServiceIndex, Compile_Find_And_Burst) {
+  ServiceRegistry reg;
+  PopList p{ Pop{.id="nyc", .region="us-east", .ip="192.0.2.10"} };
+  for (const char* id : {"web", "api", "auth", "video"}) ASSERT_EQ(reg.addService(id, as_span(p)), alpha::routing::RegistryErr::Ok);
+
+  const auto idx = ServiceIndex::compile(reg);
+  ASSERT_EQ(idx->size(), 4u);
+  EXPECT_EQ(idx->version(), reg.version());
+  EXPECT_EQ(idx->find("api"), 0u);
+  EXPECT_EQ(idx->find("auth"), 1u);
+  EXPECT_EQ(idx->id(idx->find("video")), "video");
+  EXPECT_EQ(idx->pops(idx->find("web")).front().id, "nyc");
+  EXPECT_EQ(idx->find("nope"), alpha::routing::kInvalidService);
+  EXPECT_EQ(idx->find(""), alpha::routing::kInvalidService);
+
+  std::vector<std::string_view> ids;
+  for (int i = 0; i < 20; ++i) ids.push_back(i % 5 == 4 ? std::string_view{"missing"} : idx->id(static_cast<alpha::routing::ServiceHandle>(i % 4)));
+  std::vector<alpha::routing::ServiceHandle> out(ids.size());
+  idx->find_burst(ids, out);
+  for (std::size_t i = 0; i < ids.size(); ++i) EXPECT_EQ(out[i], idx->find(ids[i]));
+
+  // The index pins its snapshot: later registry writes do not affect it.
+  ASSERT_TRUE(reg.removeService("web"));
+  EXPECT_EQ(idx->id(idx->find("web")), "web");
+  EXPECT_LT(idx->version(), reg.version());
+}
+
+/**
+ * @test CandidateSet_Compile_And_Republish
+ * @brief Per-service arrays are line-aligned, point into the pinned metrics buffer,
+ *        keep PathIds stable across registry versions and skip Down PoPs; PathIds of
+ *        removed PoPs are reused only after the sets listing them are released and an
+ *        unhealthy reset is published, so the new owner never reads the old PoP's metrics.
+ */
+TEST(ServiceIndex, CandidateSet_Compile_And_Republish) {
+  using alpha::routing::CandidateCompiler;
+  using alpha::routing::MetricsTable;
+  ServiceRegistry reg;
+  PopList web{ Pop{.id="nyc", .region="us-east", .ip="192.0.2.10"},
+               Pop{.id="lon", .region="eu-west", .ip="192.0.2.20", .health=alpha::routing::Health::Down},
+               Pop{.id="fra", .region="eu-central", .ip="192.0.2.30"} };
+  PopList api{ Pop{.id="fra", .region="eu-central", .ip="192.0.2.30"},
+               Pop{.id="sfo", .region="us-west", .ip="192.0.2.40"} };
+  ASSERT_EQ(reg.addService("web", as_span(web)), alpha::routing::RegistryErr::Ok);
+  ASSERT_EQ(reg.addService("api", as_span(api)), alpha::routing::RegistryErr::Ok);
+
+  MetricsTable table(8, 1);
+  CandidateCompiler compiler(table);
+  EXPECT_TRUE(compiler.refresh(reg));
+  EXPECT_FALSE(compiler.refresh(reg));   // same version: nothing to do
+  auto cs = compiler.current();
+  ASSERT_EQ(cs->version(), reg.version());
+
+  const auto fra = compiler.path_of("fra");
+  ASSERT_NE(fra, alpha::routing::kInvalidPath);
+  EXPECT_EQ(compiler.path_of("lon"), alpha::routing::kInvalidPath);
+  for (std::uint64_t e = 0; e < MetricsTable::kBuffers; ++e) {
+    const auto cands = cs->candidates(cs->index().find("web"), e);
+    ASSERT_EQ(cands.size(), 2u);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(cands.data()) % 64, 0u);
+    EXPECT_EQ(cands[0].id, compiler.path_of("nyc"));
+    EXPECT_EQ(cands[1].id, fra);
+    EXPECT_EQ(cands[1].slot, table.slots(e) + fra);
+  }
+  EXPECT_TRUE(cs->candidates(alpha::routing::kInvalidService, 0).empty());
+
+  // Published metrics are visible through the compiled refs of the pinned epoch.
+  std::array<alpha::routing::PathUpdate, 1> up{};
+  up[0].id = fra; up[0].metrics.rtt_us = 42; up[0].metrics.healthy = true;
+  ASSERT_TRUE(table.publish(up));
+  alpha::routing::PathMetrics m{};
+  ASSERT_TRUE(alpha::routing::dp::load_metrics(*cs->candidates(cs->index().find("api"), table.enter(0))[0].slot, m));
+  EXPECT_EQ(m.rtt_us, 42u);
+  table.leave(0);
+
+  // New registry version: republished, existing PoPs keep their slots.
+  ASSERT_TRUE(reg.removeService("web"));
+  EXPECT_TRUE(compiler.refresh(reg));
+  auto cs2 = compiler.current();
+  EXPECT_NE(cs2, cs);
+  EXPECT_EQ(cs2->paths(cs2->index().find("api"))[0], fra);
+  EXPECT_EQ(cs2->index().find("web"), alpha::routing::kInvalidService);
+  EXPECT_EQ(compiler.assigned(), 3u);
+
+  // "nyc" left with web while its last metrics were healthy. Its PathId is held while cs
+  // (which lists it) is pinned and until its reset is published; then it is reused.
+  const auto nyc = cs->paths(cs->index().find("web"))[0];
+  EXPECT_EQ(compiler.path_of("nyc"), alpha::routing::kInvalidPath);
+  up[0].id = nyc; up[0].metrics.rtt_us = 5;
+  ASSERT_TRUE(table.publish(up));
+  PopList edge{ Pop{.id="sin", .region="ap-south", .ip="192.0.2.50"} };
+  ASSERT_EQ(reg.addService("edge", as_span(edge)), alpha::routing::RegistryErr::Ok);
+  EXPECT_TRUE(compiler.refresh(reg));
+  EXPECT_NE(compiler.path_of("sin"), nyc);
+  EXPECT_EQ(compiler.assigned(), 4u);
+
+  cs.reset();
+  PopList video{ Pop{.id="ams", .region="eu-west", .ip="192.0.2.60"} };
+  ASSERT_EQ(reg.addService("video", as_span(video)), alpha::routing::RegistryErr::Ok);
+  EXPECT_TRUE(compiler.refresh(reg));
+  EXPECT_NE(compiler.path_of("ams"), nyc);   // released, but the reset is not published yet
+
+  std::vector<alpha::routing::PathUpdate> resets;
+  compiler.reset_updates(resets);
+  compiler.reset_updates(resets);            // handed out once
+  ASSERT_EQ(resets.size(), 1u);
+  EXPECT_EQ(resets[0].id, nyc);
+  EXPECT_FALSE(resets[0].metrics.healthy);
+  ASSERT_TRUE(table.publish(resets));
+
+  PopList cdn{ Pop{.id="syd", .region="ap-southeast", .ip="192.0.2.70"} };
+  ASSERT_EQ(reg.addService("cdn", as_span(cdn)), alpha::routing::RegistryErr::Ok);
+  EXPECT_TRUE(compiler.refresh(reg));
+  ASSERT_EQ(compiler.path_of("syd"), nyc);
+  EXPECT_EQ(compiler.assigned(), 5u);
+  auto cs3 = compiler.current();
+  const auto syd = [&] {
+    alpha::routing::PathMetrics pm{};
+    EXPECT_TRUE(alpha::routing::dp::load_metrics(*cs3->candidates(cs3->index().find("cdn"), table.enter(0))[0].slot, pm));
+    table.leave(0);
+    return pm;
+  };
+  EXPECT_FALSE(syd().healthy);               // not nyc's last metrics
+  up[0].metrics.rtt_us = 77;
+  ASSERT_TRUE(table.publish(up));
+  EXPECT_TRUE(syd().healthy);
+  EXPECT_EQ(syd().rtt_us, 77u);
+  EXPECT_EQ(compiler.overflowed(), 0u);
+}
+
+/**
+ * @test DecisionTable_MatchesPolicy_And_Staleness
+ * @brief Built decisions equal LatencyAwarePolicy::choose(); lookups miss for an
+ *        unbuilt epoch or a newer CandidateSet and choose() falls back.
+ */
+TEST(ServiceIndex, DecisionTable_MatchesPolicy_And_Staleness) {
+  using alpha::routing::CandidateCompiler;
+  using alpha::routing::DecisionTable;
+  using alpha::routing::LatencyAwareConfig;
+  using alpha::routing::LatencyAwarePolicy;
+  using alpha::routing::MetricsTable;
+  using alpha::routing::PacketContext;
+  using alpha::routing::PathUpdate;
+  ServiceRegistry reg;
+  const char* pops[] = {"nyc", "lon", "fra", "sfo", "sin"};
+  const char* ips[]  = {"192.0.2.1", "192.0.2.2", "192.0.2.3", "192.0.2.4", "192.0.2.5"};
+  for (int s = 0; s < 6; ++s) {
+    PopList pl;
+    for (int k = 0; k < 2 + s % 3; ++k) pl.push_back(Pop{.id=pops[(s + k) % 5], .region="eu", .ip=ips[(s + k) % 5]});
+    ASSERT_EQ(reg.addService("svc" + std::to_string(s), as_span(pl)), alpha::routing::RegistryErr::Ok);
+  }
+  MetricsTable metrics(8, 1);
+  CandidateCompiler compiler(metrics);
+  ASSERT_TRUE(compiler.refresh(reg));
+  const auto cs = compiler.current();
+
+  const LatencyAwareConfig cfg{};
+  const std::uint8_t class_dscp[] = {0, 46};
+  DecisionTable table(cfg, class_dscp, 16);
+  LatencyAwarePolicy ref(cfg);
+  std::mt19937_64 rng{7};
+
+  for (int tick = 0; tick < 50; ++tick) {
+    std::vector<PathUpdate> ups(5);
+    for (std::uint32_t id = 0; id < 5; ++id) {
+      ups[id].id = id;
+      ups[id].metrics.rtt_us    = static_cast<std::uint32_t>(rng() % 500);
+      ups[id].metrics.qos_class = static_cast<std::uint8_t>(rng() % 2);
+      ups[id].metrics.healthy   = (rng() % 4) != 0;
+    }
+    ASSERT_TRUE(metrics.publish(ups));
+    const auto e = metrics.enter(0);
+    EXPECT_EQ(table.lookup(*cs, 0, 0, e), nullptr);            // not built yet
+    ASSERT_TRUE(table.build(*cs, metrics, e));
+    EXPECT_FALSE(table.build(*cs, metrics, e));                // already claimed
+    for (alpha::routing::ServiceHandle h = 0; h < cs->index().size(); ++h) {
+      const auto cands = cs->candidates(h, e);
+      for (std::size_t k = 0; k < 2; ++k) {
+        const PacketContext pkt{.flow_hash = static_cast<std::uint32_t>(rng()), .dscp = class_dscp[k]};
+        const auto* d = table.lookup(*cs, h, k, e);
+        ASSERT_NE(d, nullptr);
+        ASSERT_EQ(d->best, ref.choose(cands, pkt));
+        EXPECT_EQ(table.choose(*cs, h, k, e, pkt), d->best);
+        EXPECT_NE(d->backup, d->best);
+      }
+    }
+    metrics.leave(0);
+  }
+
+  // A newer CandidateSet is stale for the built table: choose() falls back.
+  ASSERT_TRUE(reg.removeService("svc0"));
+  ASSERT_TRUE(compiler.refresh(reg));
+  const auto cs2 = compiler.current();
+  const auto e = metrics.enter(0);
+  EXPECT_EQ(table.lookup(*cs2, 0, 0, e), nullptr);
+  const PacketContext pkt{.flow_hash = 1, .dscp = 0};
+  EXPECT_EQ(table.choose(*cs2, 0, 0, e, pkt), ref.choose(cs2->candidates(0, e), pkt));
+  metrics.leave(0);
+}
+
+/**
+ * @test VipTable_Resolve_And_Refresh
+ * @brief Perfect-hash lookups resolve every binding (exact port before any-port),
+ *        burst agrees with scalar, duplicates are rejected, and the resolver
+ *        republishes on registry or binding changes only (a version bump alone suffices).
+ */
+TEST(ServiceIndex, VipTable_Resolve_And_Refresh) {
+  using alpha::routing::VipBinding;
+  using alpha::routing::VipKey;
+  using alpha::routing::VipTable;
+  using alpha::routing::kInvalidService;
+  ServiceRegistry reg;
+  PopList p{ Pop{.id="nyc", .region="us-east", .ip="192.0.2.10"} };
+  for (const char* id : {"web", "api", "dns"}) ASSERT_EQ(reg.addService(id, as_span(p)), alpha::routing::RegistryErr::Ok);
+
+  std::vector<VipBinding> binds{
+    {0xC6336401u, 443, 6, "web"}, {0xC6336401u, 80, 6, "web"}, {0xC6336402u, 443, 6, "api"},
+    {0xC6336403u, 0, 17, "dns"},  {0xC6336404u, 80, 6, "gone"}};
+  // Bulk bindings: one VIP per service instance, exercises the displacement search.
+  for (std::uint32_t i = 0; i < 3000; ++i) binds.push_back({0x0A000000u + i, static_cast<std::uint16_t>(8000 + i % 7), 6, i % 2 ? "api" : "web"});
+
+  alpha::routing::VipResolver resolver;
+  resolver.set_bindings(binds);
+  auto r = resolver.refresh(reg);
+  ASSERT_TRUE(r && *r);
+  EXPECT_FALSE(*resolver.refresh(reg));  // nothing changed
+  const auto t = resolver.current();
+  EXPECT_EQ(t->size(), binds.size() - 1);
+  EXPECT_EQ(t->unresolved(), 1u);
+
+  const auto& idx = t->index();
+  EXPECT_EQ(t->find({0xC6336401u, 443, 6}), idx.find("web"));
+  EXPECT_EQ(t->find({0xC6336402u, 443, 6}), idx.find("api"));
+  EXPECT_EQ(t->find({0xC6336402u, 443, 17}), kInvalidService);   // wrong protocol
+  EXPECT_EQ(t->find({0xC6336403u, 5353, 17}), idx.find("dns"));  // any-port binding
+  EXPECT_EQ(t->find({0xC6336404u, 80, 6}), kInvalidService);     // unresolved service
+  for (std::uint32_t i = 0; i < 3000; ++i)
+    ASSERT_EQ(t->find({0x0A000000u + i, static_cast<std::uint16_t>(8000 + i % 7), 6}), idx.find(i % 2 ? "api" : "web"));
+
+  std::vector<VipKey> keys;
+  for (std::uint32_t i = 0; i < 100; ++i) keys.push_back({0x0A000000u + i * 13, static_cast<std::uint16_t>(8000 + (i * 13) % 7 + (i % 5 == 0)), 6});
+  keys.push_back({0xC6336403u, 53, 17});
+  std::vector<alpha::routing::ServiceHandle> out(keys.size());
+  t->find_burst(keys, out);
+  for (std::size_t i = 0; i < keys.size(); ++i) EXPECT_EQ(out[i], t->find(keys[i]));
+
+  // Duplicate bindings do not compile; the previous table stays published.
+  binds.push_back(binds.front());
+  resolver.set_bindings(binds);
+  auto bad = resolver.refresh(reg);
+  ASSERT_FALSE(bad);
+  EXPECT_EQ(bad.error(), alpha::routing::VipError::Duplicate);
+  EXPECT_EQ(resolver.current(), t);
+
+  // Registry change: handles re-resolved against the new version.
+  binds.pop_back();
+  resolver.set_bindings(binds);
+  ASSERT_TRUE(reg.removeService("api"));
+  ASSERT_TRUE(*resolver.refresh(reg));
+  const auto t2 = resolver.current();
+  EXPECT_EQ(t2->index().version(), reg.version());
+  EXPECT_EQ(t2->find({0xC6336402u, 443, 6}), kInvalidService);
+  EXPECT_EQ(t2->find({0xC6336401u, 80, 6}), t2->index().find("web"));
+
+  // A version bump alone (bindings untouched) also republishes.
+  ASSERT_TRUE(reg.removeService("dns"));
+  ASSERT_TRUE(*resolver.refresh(reg));
+  const auto t3 = resolver.current();
+  EXPECT_NE(t3, t2);
+  EXPECT_EQ(t3->index().version(), reg.version());
+  EXPECT_EQ(t3->find({0xC6336403u, 53, 17}), kInvalidService);
+  EXPECT_EQ(t3->find({0xC6336401u, 443, 6}), t3->index().find("web"));
+  EXPECT_FALSE(*resolver.refresh(reg));
+}
+
+// --------------------------- Classifier -------------------------------------
+
+/**
+ * @test Classifier_MatchesLinearScan
+ * @brief Tuple-space first-match equals a linear scan over random rules (prefixes,
+ *        port ranges, proto/DSCP wildcards); burst agrees with scalar; bad rules rejected.
+ */
+TEST(Classifier, MatchesLinearScan_And_Burst) {
+  using alpha::routing::ClassAction;
+  using alpha::routing::Classifier;
+  using alpha::routing::ClassifierKey;
+  using alpha::routing::ClassifierRule;
+  std::mt19937 rng{11};
+  auto pick = [&](std::uint32_t n) { return static_cast<std::uint32_t>(rng() % n); };
+  const std::uint8_t lens[] = {0, 8, 16, 24, 32};
+
+  std::vector<ClassifierRule> rules(300);
+  for (std::uint32_t i = 0; i < rules.size(); ++i) {
+    auto& r = rules[i];
+    r.src_len = lens[1 + pick(4)];  r.src_ip = 0x0A000000u | pick(4) << 16 | pick(4);
+    r.dst_len = lens[pick(5)];  r.dst_ip = 0xC0A80000u | pick(4) << 8 | pick(4);
+    if (pick(2)) { r.src_port_lo = static_cast<std::uint16_t>(pick(2000)); r.src_port_hi = static_cast<std::uint16_t>(r.src_port_lo + pick(3000)); }
+    if (pick(2)) { r.dst_port_lo = r.dst_port_hi = static_cast<std::uint16_t>(pick(4) * 100 + 80); }
+    if (pick(2)) { r.any_proto = false; r.proto = pick(2) ? 6 : 17; }
+    if (pick(4) == 0) { r.any_dscp = false; r.dscp = static_cast<std::uint8_t>(pick(2) * 46); }
+    r.action = ClassAction{i, static_cast<std::uint8_t>(i % 4), static_cast<std::uint8_t>(i % 3)};
+  }
+  const ClassAction miss{alpha::routing::kInvalidService, 0, 7};
+  auto c = Classifier::compile(rules, miss);
+  ASSERT_TRUE(c);
+  const auto& cls = **c;
+  EXPECT_EQ(cls.rules(), rules.size());
+  EXPECT_LT(cls.tuples(), rules.size());
+
+  auto linear = [&](const ClassifierKey& k) -> std::uint32_t {
+    for (std::uint32_t i = 0; i < rules.size(); ++i) {
+      const auto& r = rules[i];
+      auto pm = [](std::uint32_t v, std::uint32_t p, std::uint8_t len) {
+        return len == 0 || ((v ^ p) >> (32 - len)) == 0;
+      };
+      if (!pm(k.src_ip, r.src_ip, r.src_len) || !pm(k.dst_ip, r.dst_ip, r.dst_len)) continue;
+      if (k.src_port < r.src_port_lo || k.src_port > r.src_port_hi) continue;
+      if (k.dst_port < r.dst_port_lo || k.dst_port > r.dst_port_hi) continue;
+      if (!r.any_proto && k.proto != r.proto) continue;
+      if (!r.any_dscp && k.dscp != r.dscp) continue;
+      return i;
+    }
+    return Classifier::kNoRule;
+  };
+
+  std::vector<ClassifierKey> keys(5000);
+  for (auto& k : keys) {
+    k.src_ip   = (pick(10) ? 0x0A000000u : 0x0B000000u) | pick(4) << 16 | pick(4);
+    k.dst_ip   = 0xC0A80000u | pick(4) << 8 | pick(4);
+    k.src_port = static_cast<std::uint16_t>(pick(6000));
+    k.dst_port = static_cast<std::uint16_t>(pick(5) * 100 + 80);
+    k.proto    = pick(2) ? 6 : 17;
+    k.dscp     = static_cast<std::uint8_t>(pick(2) * 46);
+  }
+  std::size_t hits = 0;
+  for (const auto& k : keys) {
+    const auto want = linear(k);
+    ASSERT_EQ(cls.match(k), want);
+    hits += want != Classifier::kNoRule;
+  }
+  EXPECT_GT(hits, 0u);
+  EXPECT_LT(hits, keys.size());
+
+  std::vector<ClassAction> out(keys.size());
+  cls.classify_burst(keys, out);
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    const auto want = cls.classify(keys[i]);
+    ASSERT_EQ(out[i].service, want.service);
+    ASSERT_EQ(out[i].policy, want.policy);
+  }
+
+  // Validation: nothing compiled on bad input; the slot swaps whole classifiers.
+  ClassifierRule bad{};
+  bad.src_len = 33;
+  EXPECT_EQ(Classifier::compile(std::span(&bad, 1)).error(), alpha::routing::ClassifierError::BadPrefix);
+  bad.src_len = 0; bad.dst_port_lo = 10; bad.dst_port_hi = 5;
+  EXPECT_EQ(Classifier::compile(std::span(&bad, 1)).error(), alpha::routing::ClassifierError::BadRange);
+
+  alpha::routing::ClassifierSlot slot;
+  EXPECT_EQ(slot.current()->classify(keys[0]).service, alpha::routing::kInvalidService);
+  slot.publish(*c);
+  EXPECT_EQ(slot.current().get(), c->get());
+}
+
+/**
+ * @test Classifier_PortOnlyAcl
+ * @brief Many rules on one address pair (0/0 → VIP) differing only in port or protocol are
+ *        split by port/protocol: chains stay near kClassifierChainCap (only the unsplittable
+ *        catch-all rides past it) and first-match holds.
+ */
+TEST(Classifier, PortOnlyAcl_ChainsBounded) {
+  using alpha::routing::ClassAction;
+  using alpha::routing::Classifier;
+  using alpha::routing::ClassifierKey;
+  using alpha::routing::ClassifierRule;
+  constexpr std::uint32_t vip = 0xC6336401u;
+
+  std::vector<ClassifierRule> rules;
+  for (std::uint32_t p = 0; p < 400; ++p) {   // 400 exact ports, TCP and UDP
+    ClassifierRule r{};
+    r.dst_ip = vip; r.dst_len = 32;
+    r.dst_port_lo = r.dst_port_hi = static_cast<std::uint16_t>(1000 + p / 2);
+    r.any_proto = false; r.proto = p % 2 ? 17 : 6;
+    r.action = ClassAction{p, 0, 0};
+    rules.push_back(r);
+  }
+  ClassifierRule any{};                        // catch-all for the VIP, last
+  any.dst_ip = vip; any.dst_len = 32;
+  any.action = ClassAction{999, 0, 0};
+  rules.push_back(any);
+
+  auto c = Classifier::compile(rules);
+  ASSERT_TRUE(c);
+  const auto& cls = **c;
+  EXPECT_LE(cls.max_chain(), alpha::routing::kClassifierChainCap + 1);  // + the any-port rule
+  EXPECT_LE(cls.tuples(), 4u);
+
+  ClassifierKey k{};
+  k.dst_ip = vip;
+  for (std::uint32_t p = 0; p < 400; ++p) {
+    k.dst_port = static_cast<std::uint16_t>(1000 + p / 2);
+    k.proto = p % 2 ? 17 : 6;
+    ASSERT_EQ(cls.match(k), p);
+  }
+  k.dst_port = 80;
+  EXPECT_EQ(cls.match(k), 400u);
+  k.dst_ip = vip + 1;
+  EXPECT_EQ(cls.match(k), Classifier::kNoRule);
+}
+
+// --------------------------- Overlay ----------------------------------------
+
+/**
+ * @test Overlay_RelaysMatchBruteForce
+ * @brief Min-plus one/two-relay costs equal exhaustive search on a random sparse matrix;
+ *        relay candidates are healthy exactly when they beat the direct leg.
+ */
+TEST(Overlay, RelaysMatchBruteForce_And_Updates) {
+  using alpha::routing::OverlayClass;
+  using alpha::routing::OverlayMatrix;
+  using alpha::routing::OverlayRouter;
+  using alpha::routing::OverlayTable;
+  using alpha::routing::PathId;
+  using alpha::routing::PopIndex;
+
+  constexpr std::size_t n = 24;
+  OverlayMatrix m(n);
+  std::mt19937 rng{5};
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t j = 0; j < n; ++j)
+      if (i != j && rng() % 4 != 0)
+        m.set(static_cast<PopIndex>(i), static_cast<PopIndex>(j), static_cast<std::uint32_t>(1000 + rng() % 50000),
+              static_cast<std::uint32_t>(rng() % 3 ? 0 : rng() % 20000));
+
+  const std::vector<OverlayClass> classes{{0, 0}, {2'000'000, 500}};
+  OverlayRouter router(classes);
+  EXPECT_EQ(router.current()->pops(), 0u);
+  const auto t = router.recompute(m);
+  EXPECT_EQ(router.current(), t);
+  EXPECT_EQ(t->generation(), 1u);
+
+  constexpr std::uint64_t kNone = ~std::uint64_t{0} >> 2;
+  auto brute_force = [&](const OverlayMatrix& mm, const alpha::routing::OverlayTable& tt) {
+    auto leg = [&](std::size_t a, std::size_t b, const OverlayClass& c) -> std::uint64_t {
+      const auto f = static_cast<PopIndex>(a), to = static_cast<PopIndex>(b);
+      if (!mm.up(f, to)) return kNone;
+      return mm.rtt_us(f, to) + std::uint64_t{mm.loss_ppm(f, to)} * c.loss_penalty_us / 1'000'000;
+    };
+    const std::size_t np = mm.size();
+    for (std::uint8_t c = 0; c < classes.size(); ++c) {
+      const auto& oc = classes[c];
+      for (std::size_t i = 0; i < np; ++i) {
+        for (std::size_t j = 0; j < np; ++j) {
+          if (i == j) continue;
+          std::uint64_t one = kNone, two = kNone;
+          for (std::size_t k = 0; k < np; ++k) {
+            if (leg(i, k, oc) == kNone) continue;
+            if (leg(k, j, oc) != kNone) one = std::min(one, leg(i, k, oc) + leg(k, j, oc));
+            for (std::size_t l = 0; l < np; ++l)
+              if (k != j && l != i && leg(k, l, oc) != kNone && leg(l, j, oc) != kNone)  // simple paths only
+                two = std::min(two, leg(i, k, oc) + leg(k, l, oc) + leg(l, j, oc));
+          }
+          const auto r1 = tt.relay(static_cast<PopIndex>(i), static_cast<PopIndex>(j), c, 1);
+          const auto r2 = tt.relay(static_cast<PopIndex>(i), static_cast<PopIndex>(j), c, 2);
+          ASSERT_EQ(r1.valid, one != kNone) << i << "->" << j;
+          ASSERT_EQ(r2.valid, two != kNone) << i << "->" << j;
+          if (r1.valid) { ASSERT_EQ(r1.cost_us, one + oc.relay_penalty_us) << i << "->" << j; }
+          if (r2.valid) {
+            ASSERT_EQ(r2.cost_us, two + 2u * oc.relay_penalty_us) << i << "->" << j;
+            for (const PopIndex v : r2.via) { ASSERT_NE(v, i); ASSERT_NE(v, j); }
+          }
+        }
+      }
+    }
+  };
+  brute_force(m, *t);
+
+  // Ingress 0's cheapest round trip goes via the destination 1 (0 → 1 → 0), and so does its
+  // best D2 entry to 2: neither the runner-up round trip nor 0 → 2 → 0 → 1 may be used.
+  OverlayMatrix loop(4);
+  loop.set(0, 1, 5, 0);  loop.set(1, 0, 1, 0);
+  loop.set(0, 2, 10, 0); loop.set(2, 0, 10, 0);
+  loop.set(1, 2, 1, 0);  loop.set(2, 1, 1, 0);
+  loop.set(3, 1, 1, 0);
+  const auto lt = OverlayTable::compute(loop, classes);
+  EXPECT_FALSE(lt->relay(0, 1, 0, 2).valid);
+  brute_force(loop, *lt);
+
+  // Relay candidates for ingress 0: one PathId per destination and relay count.
+  std::vector<PathId> one_ids(n), two_ids(n);
+  for (std::size_t j = 0; j < n; ++j) {
+    one_ids[j] = static_cast<PathId>(j);
+    two_ids[j] = static_cast<PathId>(n + j);
+  }
+  std::vector<alpha::routing::PathUpdate> ups;
+  t->relay_updates(0, 1, one_ids, two_ids, ups);
+  ASSERT_EQ(ups.size(), 2 * (n - 1));
+  std::size_t useful = 0;
+  for (const auto& u : ups) {
+    const auto to = static_cast<PopIndex>(u.id % n);
+    const auto r  = t->relay(0, to, 1, u.id < n ? 1 : 2);
+    const auto d  = t->direct(0, to, 1);
+    EXPECT_EQ(u.metrics.healthy, r.valid && (!d.valid || r.cost_us < d.cost_us));
+    if (u.metrics.healthy) { EXPECT_LE(t->best(0, to, 1).cost_us, r.cost_us); }
+    useful += u.metrics.healthy ? 1u : 0u;
+  }
+  EXPECT_GT(useful, 0u);
+}
+
+/**
+ * @test Overlay_IncrementalShortestPaths
+ * @brief Random batches of edge inserts/removals/increases/decreases: incremental trees match
+ *        Floyd–Warshall after every apply(), paths sum to their distance, old snapshots stay
+ *        intact and no-op batches publish nothing.
+ */
+TEST(Overlay, IncrementalShortestPaths_MatchFloydWarshall) {
+  using alpha::routing::PopIndex;
+  using alpha::routing::ShortestPathSnapshot;
+  using alpha::routing::ShortestPaths;
+
+  constexpr std::size_t n = 30;
+  constexpr std::uint64_t kUnreach = ShortestPathSnapshot::kUnreachable;
+  std::mt19937 rng{17};
+  ShortestPaths sp(n, {}, 64);
+  std::vector<std::uint32_t> w(n * n, ShortestPaths::kNoEdge);
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t j = 0; j < n; ++j)
+      if (i != j && rng() % 5 == 0) {
+        w[i * n + j] = static_cast<std::uint32_t>(1 + rng() % 100);
+        sp.set_edge(static_cast<PopIndex>(i), static_cast<PopIndex>(j), w[i * n + j]);
+      }
+  EXPECT_TRUE(sp.apply().rebuilt);  // initial load is a large batch
+
+  auto floyd = [&] {
+    std::vector<std::uint64_t> d(n * n, kUnreach);
+    for (std::size_t i = 0; i < n; ++i) {
+      d[i * n + i] = 0;
+      for (std::size_t j = 0; j < n; ++j) if (w[i * n + j] != ShortestPaths::kNoEdge) d[i * n + j] = w[i * n + j];
+    }
+    for (std::size_t k = 0; k < n; ++k)
+      for (std::size_t i = 0; i < n; ++i)
+        for (std::size_t j = 0; j < n; ++j)
+          if (d[i * n + k] != kUnreach && d[k * n + j] != kUnreach)
+            d[i * n + j] = std::min(d[i * n + j], d[i * n + k] + d[k * n + j]);
+    return d;
+  };
+  auto check = [&](const ShortestPathSnapshot& s, const std::vector<std::uint64_t>& ref, const std::vector<std::uint32_t>& wt) {
+    std::array<PopIndex, n> hops{};
+    for (std::size_t i = 0; i < n; ++i) {
+      for (std::size_t j = 0; j < n; ++j) {
+        const auto a = static_cast<PopIndex>(i), b = static_cast<PopIndex>(j);
+        ASSERT_EQ(s.distance(a, b), ref[i * n + j]) << i << "->" << j;
+        if (i == j || ref[i * n + j] == kUnreach) continue;
+        const std::size_t len = s.path(a, b, hops);
+        ASSERT_GE(len, 2u);
+        std::uint64_t sum = 0;
+        for (std::size_t h = 0; h + 1 < len; ++h) sum += wt[std::size_t{hops[h]} * n + hops[h + 1]];
+        ASSERT_EQ(sum, ref[i * n + j]);
+        ASSERT_EQ(s.next_hop(a, b), hops[1]);
+      }
+    }
+  };
+  check(*sp.current(), floyd(), w);
+
+  std::size_t incremental = 0;
+  for (int round = 0; round < 60; ++round) {
+    const auto before = sp.current();
+    const auto before_ref = floyd();
+    const auto before_w = w;
+    const std::size_t changes = 1 + rng() % 6;
+    for (std::size_t c = 0; c < changes; ++c) {
+      const std::size_t i = rng() % n, j = rng() % n;
+      if (i == j) continue;
+      std::uint32_t& e = w[i * n + j];
+      switch (rng() % 4) {
+        case 0:  e = ShortestPaths::kNoEdge; break;                                  // remove
+        case 1:  e = static_cast<std::uint32_t>(1 + rng() % 100); break;             // insert / reweight
+        case 2:  if (e != ShortestPaths::kNoEdge) e += static_cast<std::uint32_t>(rng() % 50); break;
+        default: if (e != ShortestPaths::kNoEdge) e = std::max<std::uint32_t>(1, e / 2); break;
+      }
+      sp.set_edge(static_cast<PopIndex>(i), static_cast<PopIndex>(j), e);
+    }
+    const auto st = sp.apply();
+    EXPECT_FALSE(st.rebuilt);
+    incremental += st.recomputed;
+    check(*sp.current(), floyd(), w);
+    check(*before, before_ref, before_w);                 // readers holding the old snapshot are unaffected
+  }
+  EXPECT_LT(incremental, 60u * n * n);          // churn-proportional, not 60 full recomputes
+
+  // A no-op batch publishes nothing.
+  const auto v = sp.current()->version();
+  sp.set_edge(0, 1, w[1]);
+  const auto st = sp.apply();
+  EXPECT_EQ(st.rows, 0u);
+  EXPECT_EQ(sp.current()->version(), v);
+}
+
+// --------------------------- Traffic shift ----------------------------------
+
+using alpha::routing::PathId;
+using alpha::routing::ShiftConfig;
+using alpha::routing::ShiftController;
+using alpha::routing::ShiftEvent;
+using alpha::routing::ShiftState;
+using alpha::routing::TrafficSplit;
+
+/**
+ * @test TrafficShift_GatedRamp
+ * @brief Splits move the configured share of flows, a higher share keeps every flow already moved,
+ *        a failed gate aborts to the source, reversal returns the last-moved flows first,
+ *        and all services changed in a tick land in one published table.
+ */
+TEST(TrafficShift, GatedRamp_Abort_Reverse) {
+  ShiftConfig cfg;
+  cfg.step_ppm = 250'000;
+  cfg.step_hold_ms = 100;
+  cfg.max_rtt_us = 20'000;
+  ShiftController ctl(3, cfg);
+  std::vector<alpha::routing::MetricsSlot> slots(3);
+  auto set = [&](std::size_t p, std::uint32_t rtt, bool healthy) {
+    alpha::routing::PathMetrics m{};
+    m.rtt_us = rtt;
+    m.healthy = healthy;
+    alpha::routing::cp::update_metrics(slots[p], m);
+  };
+  set(0, 8'000, true);   // backup
+  set(1, 5'000, true);   // recovering primary
+  set(2, 5'000, false);
+
+  constexpr std::uint32_t kFlows = 100'000;
+  auto on = [&](alpha::routing::ServiceHandle h, PathId p) {
+    std::vector<std::uint32_t> v;
+    const auto t = ctl.current();
+    for (std::uint32_t f = 0; f < kFlows; ++f) {
+      if (t->route(h, f * 2654435761u + 17u, 99) == p) v.push_back(f);
+    }
+    return v;
+  };
+
+  const auto t0 = std::chrono::steady_clock::now();
+  EXPECT_FALSE(ctl.begin(3, 0, 1, t0));
+  EXPECT_FALSE(ctl.begin(0, 1, 1, t0));
+  ASSERT_TRUE(ctl.begin(0, 0, 1, t0));
+  ASSERT_TRUE(ctl.begin(1, 0, 2, t0));   // target unhealthy: aborts on the first tick
+  std::vector<ShiftEvent> ev;
+  const auto before = ctl.current();
+  EXPECT_EQ(ctl.tick(slots, t0 + 50ms, &ev), 1u);
+  ASSERT_EQ(ev.size(), 1u);
+  EXPECT_EQ(ev[0].service, 1u);
+  EXPECT_EQ(ev[0].state, ShiftState::Aborted);
+  EXPECT_EQ(ev[0].path, 0u);             // settled on the source
+  EXPECT_FALSE(ctl.split(1).active());
+  EXPECT_NE(ctl.current(), before);
+  EXPECT_EQ(ctl.split(0).to_ppm, 0u);    // hold not elapsed
+
+  // Steps: 25% then 50%; the 25% set is a subset of the 50% set.
+  EXPECT_EQ(ctl.tick(slots, t0 + 100ms), 1u);
+  const auto q1 = on(0, 1);
+  EXPECT_NEAR(static_cast<double>(q1.size()) / kFlows, 0.25, 0.01);
+  EXPECT_EQ(on(1, 99).size(), kFlows);   // aborted: split dropped, caller's choice
+  EXPECT_EQ(on(2, 99).size(), kFlows);   // no split: caller's choice
+  ctl.tick(slots, t0 + 200ms);
+  const auto q2 = on(0, 1);
+  EXPECT_NEAR(static_cast<double>(q2.size()) / kFlows, 0.50, 0.01);
+  EXPECT_TRUE(std::includes(q2.begin(), q2.end(), q1.begin(), q1.end()));
+
+  // Primary degrades past the gate: abort, all back on the backup.
+  set(1, 30'000, true);
+  ev.clear();
+  ctl.tick(slots, t0 + 250ms, &ev);
+  ASSERT_EQ(ev.size(), 1u);
+  EXPECT_EQ(ev[0].state, ShiftState::Aborted);
+  EXPECT_EQ(ev[0].path, 0u);
+  EXPECT_EQ(on(0, 99).size(), kFlows);
+
+  // Recovered: ramp to 50%, then reverse (drain back); the flows that moved last leave first.
+  set(1, 5'000, true);
+  ASSERT_TRUE(ctl.begin(0, 0, 1, t0 + 300ms));
+  ctl.tick(slots, t0 + 400ms);
+  ctl.tick(slots, t0 + 500ms);
+  ASSERT_EQ(on(0, 1), q2);
+  ASSERT_TRUE(ctl.begin(0, 1, 0, t0 + 500ms));
+  ctl.tick(slots, t0 + 600ms);
+  EXPECT_EQ(on(0, 1), q1);
+  ev.clear();
+  ctl.tick(slots, t0 + 700ms, &ev);
+  ASSERT_EQ(ev.size(), 1u);
+  EXPECT_EQ(ev[0].state, ShiftState::Complete);
+  EXPECT_EQ(ev[0].path, 0u);
+  EXPECT_EQ(on(0, 99).size(), kFlows);
+
+  // Full ramp completes after four steps and hands the service back to the caller's choice,
+  // so a later failover away from the target is not overridden.
+  ASSERT_TRUE(ctl.begin(0, 0, 1, t0 + 700ms));
+  ev.clear();
+  for (int i = 1; i <= 4; ++i) ctl.tick(slots, t0 + 700ms + i * 100ms, &ev);
+  EXPECT_EQ(ctl.state(0), ShiftState::Complete);
+  EXPECT_EQ(ctl.ramping(), 0u);
+  ASSERT_EQ(ev.size(), 1u);
+  EXPECT_EQ(ev[0].to_ppm, alpha::routing::kShiftFullPpm);
+  EXPECT_EQ(ev[0].path, 1u);
+  EXPECT_EQ(on(0, 99).size(), kFlows);
+
+  // Release abandons a ramp in progress.
+  ASSERT_TRUE(ctl.begin(0, 1, 0, t0 + 1200ms));
+  ctl.tick(slots, t0 + 1300ms);
+  EXPECT_TRUE(ctl.split(0).active());
+  ctl.release(0);
+  EXPECT_EQ(ctl.state(0), ShiftState::Idle);
+  EXPECT_EQ(on(0, 99).size(), kFlows);
+}
+
+/**
+ * @test TrafficShift_Remap
+ * @brief Shifts follow their service id across an index recompile that renumbers handles.
+ */
+TEST(TrafficShift, Remap_FollowsServiceId) {
+  ServiceRegistry reg;
+  PopList pops{Pop{.id = "nyc", .region = "us-east", .ip = "192.0.2.10"}};
+  ASSERT_EQ(reg.addService("auth", as_span(pops)), alpha::routing::RegistryErr::Ok);
+  ASSERT_EQ(reg.addService("video", as_span(pops)), alpha::routing::RegistryErr::Ok);
+  const auto v1 = ServiceIndex::compile(reg);   // auth=0, video=1
+
+  ShiftConfig cfg;
+  cfg.step_hold_ms = 0;
+  ShiftController ctl(v1->size(), cfg);
+  std::vector<alpha::routing::MetricsSlot> slots(2);
+  alpha::routing::PathMetrics m{};
+  m.healthy = true;
+  alpha::routing::cp::update_metrics(slots[1], m);
+  const auto t0 = std::chrono::steady_clock::now();
+  ASSERT_TRUE(ctl.begin(v1->find("video"), 0, 1, t0));
+  ctl.tick(slots, t0);
+  const TrafficSplit moving = ctl.split(v1->find("video"));
+  ASSERT_TRUE(moving.active());
+
+  ASSERT_EQ(reg.addService("api", as_span(pops)), alpha::routing::RegistryErr::Ok);   // api, auth, video
+  ASSERT_TRUE(reg.removeService("auth"));                                              // api, video
+  ASSERT_EQ(reg.addService("web", as_span(pops)), alpha::routing::RegistryErr::Ok);   // api, video, web
+  ASSERT_EQ(reg.addService("edge", as_span(pops)), alpha::routing::RegistryErr::Ok);  // api, edge, video, web
+  const auto v2 = ServiceIndex::compile(reg);
+  ctl.remap(*v1, *v2);
+
+  const alpha::routing::ServiceHandle video = v2->find("video");
+  ASSERT_EQ(video, 2u);
+  EXPECT_EQ(ctl.state(video), ShiftState::Ramping);
+  EXPECT_EQ(ctl.split(video).to, moving.to);
+  EXPECT_EQ(ctl.split(video).to_ppm, moving.to_ppm);
+  EXPECT_EQ(ctl.ramping(), 1u);
+  for (const char* id : {"api", "edge", "web"}) {
+    EXPECT_FALSE(ctl.current()->split(v2->find(id)).active()) << id;
+  }
+  ctl.tick(slots, t0 + 1ms);                     // the ramp continues on the new handle
+  EXPECT_GT(ctl.split(video).to_ppm, moving.to_ppm);
+}
+
+// --------------------------- RSS indirection --------------------------------
+
+using alpha::routing::kRssBuckets;
+using alpha::routing::RssRebalancer;
+using alpha::routing::RssTable;
+using alpha::routing::WorkerId;
+
+/**
+ * @test RssRebalancer_Zipf
+ * @brief Zipf-skewed bucket load: a few rounds bring max/mean close to 1.
+ */
+TEST(RssTable, Rebalancer_ConvergesUnderZipf) {
+  constexpr WorkerId W = 4; // hottest Zipf bucket (~15% of load) stays below the mean
+  RssTable table(W);
+  RssRebalancer rb({.target_ratio = 1.05, .max_moves = 32});
+  FlowTable dummy(16);
+
+  // Zipf(s=1) weights over a shuffled bucket order.
+  std::array<double, kRssBuckets> weight{};
+  std::vector<std::size_t> order(kRssBuckets);
+  for (std::size_t i = 0; i < kRssBuckets; ++i) order[i] = i;
+  std::shuffle(order.begin(), order.end(), std::mt19937{7});
+  for (std::size_t r = 0; r < kRssBuckets; ++r) weight[order[r]] = 1.0 / static_cast<double>(r + 1);
+
+  auto drive = [&] {
+    for (std::size_t b = 0; b < kRssBuckets; ++b) {
+      const auto pkts = static_cast<std::uint32_t>(std::lround(weight[b] * 100000.0));
+      table.record(table.worker_of(static_cast<std::uint32_t>(b)), static_cast<std::uint32_t>(b), pkts);
+    }
+  };
+  auto worker_imbalance = [&] {
+    std::vector<std::uint64_t> wl(W, 0);
+    for (std::size_t b = 0; b < kRssBuckets; ++b) {
+      wl[table.worker_of(static_cast<std::uint32_t>(b))] += static_cast<std::uint64_t>(weight[b] * 100000.0);
+    }
+    return RssRebalancer::imbalance(wl);
+  };
+
+  const double before = worker_imbalance();
+  for (int round = 0; round < 10; ++round) {
+    drive();
+    (void)rb.run_once(table);
+    // Let every worker run its phases (Export → Import → Purge).
+    for (int pass = 0; pass < 3; ++pass)
+      for (WorkerId w = 0; w < W; ++w) (void)table.service_migrations(w, dummy);
+  }
+  const double after = worker_imbalance();
+  EXPECT_GT(before, 1.2);
+  EXPECT_LT(after, before);
+  EXPECT_LT(after, 1.10);
+}
+
+/**
+ * @test RssTable_Migration_PreservesPins
+ * @brief Flow pins of a moved bucket appear at the new owner and leave the old one.
+ */
+TEST(RssTable, Migration_PreservesPins) {
+  RssTable table(2);
+  FlowTable w0(256), w1(256);
+
+  const std::uint32_t bucket = 6; // owned by worker 0 (6 % 2)
+  ASSERT_EQ(table.worker_of(bucket), 0);
+  // Two flows in the bucket, one elsewhere.
+  ASSERT_TRUE(w0.insert(101, bucket, 7));
+  ASSERT_TRUE(w0.insert(102, bucket + kRssBuckets, 3));
+  ASSERT_TRUE(w0.insert(103, 8, 5));
+
+  ASSERT_TRUE(table.begin_migration({.bucket = bucket, .from = 0, .to = 1}));
+  EXPECT_FALSE(table.begin_migration({.bucket = bucket, .from = 0, .to = 1})); // already moving
+  EXPECT_TRUE(table.migrating(bucket));
+
+  EXPECT_EQ(table.service_migrations(1, w1), 0u); // not our phase yet
+  EXPECT_EQ(table.service_migrations(0, w0), 1u); // export + flip
+  EXPECT_EQ(table.worker_of(bucket), 1);
+  EXPECT_EQ(table.service_migrations(1, w1), 1u); // import
+  EXPECT_EQ(table.service_migrations(0, w0), 1u); // purge
+  EXPECT_FALSE(table.migrating(bucket));
+
+  ASSERT_NE(w1.find(101), nullptr);
+  EXPECT_EQ(w1.find(101)->path, 7u);
+  ASSERT_NE(w1.find(102), nullptr);
+  EXPECT_EQ(w1.find(102)->path, 3u);
+  EXPECT_EQ(w0.find(101), nullptr);
+  EXPECT_EQ(w0.find(102), nullptr);
+  EXPECT_NE(w0.find(103), nullptr); // other buckets untouched
+  EXPECT_EQ(table.handoff_dropped(), 0u);
+}
+
+/**
+ * @test RssTable_Migration_AdoptOnMiss
+ * @brief A packet processed by the new owner between the flip and its Import step
+ *        adopts the handoff on the miss instead of re-pinning the flow.
+ */
+TEST(RssTable, Migration_AdoptOnMiss) {
+  RssTable table(2);
+  FlowTable w0(256), w1(256);
+
+  const std::uint32_t bucket = 6;
+  ASSERT_TRUE(w0.insert(101, bucket, 7));
+  ASSERT_TRUE(table.begin_migration({.bucket = bucket, .from = 0, .to = 1}));
+  EXPECT_FALSE(table.adopt(1, bucket, w1));       // still exporting
+  EXPECT_EQ(table.service_migrations(0, w0), 1u); // export + flip
+  ASSERT_EQ(table.worker_of(bucket), 1);
+
+  // Worker 1 processes a post-flip packet of flow 101 before its burst boundary.
+  ASSERT_EQ(w1.find(101), nullptr);
+  EXPECT_FALSE(table.adopt(0, bucket, w0));              // not the new owner
+  EXPECT_FALSE(table.adopt(1, bucket + 1, w1));          // other bucket
+  ASSERT_TRUE(table.adopt(1, bucket + kRssBuckets, w1)); // miss in the moving bucket
+  ASSERT_NE(w1.find(101), nullptr);
+  EXPECT_EQ(w1.find(101)->path, 7u);                     // original pin, not a fresh choice
+
+  EXPECT_EQ(table.service_migrations(1, w1), 0u); // import already done
+  EXPECT_EQ(table.service_migrations(0, w0), 1u); // purge
+  EXPECT_FALSE(table.migrating(bucket));
+  EXPECT_EQ(w0.find(101), nullptr);
+}
+
+// --------------------------- Fixed-count choosers ---------------------------
+
+using alpha::routing::CandidateRef;
+using alpha::routing::FlowHashPolicy;
+using alpha::routing::LatencyAwarePolicy;
+using alpha::routing::MetricsSlot;
+using alpha::routing::PacketContext;
+using alpha::routing::PathMetrics;
+
+namespace {
+// Randomized equivalence: choose_n<N>() must agree with choose() for every input.
+template <std::size_t N>
+void expect_fixed_matches_generic(std::uint64_t seed) {
+  std::mt19937_64 rng{seed};
+  std::array<MetricsSlot, N> slots{};
+  std::array<CandidateRef, N> cands{};
+  for (std::size_t i = 0; i < N; ++i) cands[i] = {static_cast<alpha::routing::PathId>(10 + i), &slots[i]};
+
+  FlowHashPolicy fh_skip{true}, fh_any{false};
+  LatencyAwarePolicy la{};
+  LatencyAwarePolicy la_noqos{{.tie_margin_us = 50, .explore_ppm = 0, .prefer_qos_class = false}};
+  for (int round = 0; round < 2000; ++round) {
+    for (auto& s : slots) {
+      PathMetrics m{};
+      m.rtt_us    = static_cast<std::uint32_t>(rng() % 1000); // small range → frequent ties
+      m.qos_class = static_cast<std::uint8_t>(rng() % 2);
+      m.healthy   = (rng() % 3) != 0;
+      alpha::routing::cp::update_metrics(s, m);
+    }
+    const PacketContext pkt{.flow_hash = static_cast<std::uint32_t>(rng()), .dscp = 0};
+    const std::span<const CandidateRef> any(cands);
+    const std::span<const CandidateRef, N> fixed(cands);
+    ASSERT_EQ(fh_skip.choose_n<N>(fixed, pkt), fh_skip.choose(any, pkt));
+    ASSERT_EQ(fh_any.choose_n<N>(fixed, pkt), fh_any.choose(any, pkt));
+    ASSERT_EQ(la.choose_n<N>(fixed, pkt), la.choose(any, pkt));
+    ASSERT_EQ(la_noqos.choose_n<N>(fixed, pkt), la_noqos.choose(any, pkt));
+  }
+}
+} // namespace
+
+/**
+ * @test PathSelection_FixedCount_MatchesGeneric
+ * @brief Unrolled N = 2/3/4 choosers pick exactly what the generic loops pick.
+ */
+TEST(PathSelection, FixedCount_MatchesGeneric) {
+  expect_fixed_matches_generic<2>(2);
+  expect_fixed_matches_generic<3>(3);
+  expect_fixed_matches_generic<4>(4);
+  EXPECT_EQ(alpha::routing::fast_range32(0xFFFFFFFFu, 3), 2u);
+  EXPECT_EQ(alpha::routing::fast_range32(0u, 3), 0u);
+}
+
+/**
+ * @test PathSelection_PublishDispatch
+ * @brief publish_policy(b, p, n) binds the specialized thunk; a resized set falls back safely.
+ */
+TEST(PathSelection, PublishDispatch_ByCandidateCount) {
+  std::array<MetricsSlot, 5> slots{};
+  std::array<CandidateRef, 5> cands{};
+  for (std::size_t i = 0; i < slots.size(); ++i) {
+    alpha::routing::cp::update_metrics(slots[i], PathMetrics{.rtt_us = 100u - static_cast<std::uint32_t>(i) * 10u, .healthy = true});
+    cands[i] = {static_cast<alpha::routing::PathId>(i), &slots[i]};
+  }
+  LatencyAwarePolicy la{};
+  alpha::routing::PolicyBinding b{};
+
+  alpha::routing::cp::publish_policy(b, la, 3);
+  const auto three = std::span<const CandidateRef>(cands).first(3);
+  EXPECT_EQ(alpha::routing::dp::select_path(b, three, {}), 2u);          // min RTT among first 3
+  EXPECT_EQ(alpha::routing::dp::select_path(b, std::span<const CandidateRef>(cands), {}), 4u); // resized
+
+  alpha::routing::cp::publish_policy(b, la, cands.size());               // generic for N = 5
+  EXPECT_EQ(alpha::routing::dp::select_path(b, std::span<const CandidateRef>(cands), {}), 4u);
+}
+
+// --------------------------- Left-right metrics slot ------------------------
+
+/**
+ * @test LrMetricsSlot_NoTornReads
+ * @brief Readers of a left-right slot always get a complete copy, on the first try,
+ *        while a writer republishes flat out.
+ */
+TEST(PathSelection, LeftRightSlot_NoTornReads_1W_MR) {
+  alpha::routing::LrMetricsSlot slot{};
+  PathMetrics init{};
+  init.rtt_us = 0; init.one_way_delay_us = 0; init.healthy = true;
+  alpha::routing::cp::update_metrics(slot, init);
+
+  std::atomic<bool> stop{false};
+  std::atomic<bool> torn{false};
+  std::thread writer([&] {
+    for (std::uint32_t n = 1; !stop.load(std::memory_order_relaxed); ++n) {
+      PathMetrics m{};
+      m.rtt_us = n; m.one_way_delay_us = n; m.loss_ppm = n; m.healthy = true;
+      alpha::routing::cp::update_metrics(slot, m);
+      if ((n & 0xFF) == 0) std::this_thread::yield();
+    }
+  });
+  std::vector<std::thread> readers;
+  for (int r = 0; r < 2; ++r) {
+    readers.emplace_back([&] {
+      std::uint32_t last = 0;
+      for (int i = 0; i < 200000; ++i) {
+        PathMetrics m{};
+        alpha::routing::dp::load_metrics(slot, m);
+        if (m.rtt_us != m.one_way_delay_us || m.rtt_us != m.loss_ppm || !m.healthy || m.rtt_us < last) torn = true;
+        last = m.rtt_us;
+        if ((i & 0xFF) == 0) std::this_thread::yield();
+      }
+    });
+  }
+  for (auto& t : readers) t.join();
+  stop = true;
+  writer.join();
+  EXPECT_FALSE(torn.load());
+}
+
+TEST(PathSelection, MetricsTable_TickConsistent_And_Reclaim) {
+  using alpha::routing::MetricsTable;
+  using alpha::routing::PathUpdate;
+  constexpr std::size_t kPaths = 256;
+  MetricsTable table(kPaths, 2);
+
+  // A pinned reader blocks reuse of its buffer: two ticks go through, the third stalls.
+  const auto e0 = table.enter(0);
+  std::vector<PathUpdate> ups(kPaths);
+  for (std::uint32_t id = 0; id < kPaths; ++id) { ups[id].id = id; ups[id].metrics.healthy = true; }
+  EXPECT_TRUE(table.publish(ups));
+  EXPECT_TRUE(table.publish({}));
+  EXPECT_FALSE(table.publish({}));
+  EXPECT_EQ(table.stalled_ticks(), 1u);
+  EXPECT_FALSE(table.slots(e0)[7].metrics.healthy);   // still the epoch-0 view
+  table.leave(0);
+  EXPECT_TRUE(table.publish({}));
+  ASSERT_EQ(table.epoch(), 3u);
+  PathMetrics m{};
+  ASSERT_TRUE(alpha::routing::dp::load_metrics(table.slots(table.enter(1))[7], m));
+  EXPECT_TRUE(m.healthy);                              // copied forward
+  table.leave(1);
+
+  // Every burst sees one tick for all paths.
+  std::atomic<bool> stop{false};
+  std::atomic<bool> torn{false};
+  std::thread writer([&] {
+    for (std::uint32_t n = 1; !stop.load(std::memory_order_relaxed); ++n) {
+      for (auto& u : ups) { u.metrics.rtt_us = n; u.metrics.loss_ppm = n; }
+      while (!table.publish(ups) && !stop.load(std::memory_order_relaxed)) std::this_thread::yield();
+      std::this_thread::yield();
+    }
+  });
+  std::vector<std::thread> readers;
+  for (std::size_t r = 0; r < 2; ++r) {
+    readers.emplace_back([&, r] {
+      std::uint32_t last = 0;
+      for (int i = 0; i < 20000; ++i) {
+        const auto* slots = table.slots(table.enter(r));
+        const std::uint32_t tick = slots[0].metrics.rtt_us;
+        for (std::size_t p = 0; p < kPaths; ++p) {
+          if (slots[p].metrics.rtt_us != tick || slots[p].metrics.loss_ppm != tick) torn = true;
+        }
+        if (tick < last) torn = true;
+        last = tick;
+        if ((i & 0x3F) == 0) { table.leave(r); std::this_thread::yield(); }
+      }
+      table.leave(r);
+    });
+  }
+  for (auto& t : readers) t.join();
+  stop = true;
+  writer.join();
+  EXPECT_FALSE(torn.load());
+}